@@ -0,0 +1,207 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "crc.h"
+#include "crc32c.h"
+#include "stm32crc.h"
+
+
+static const struct {
+    const char* name;
+    crc_params_t par;
+    uint32_t check;
+} configs[] = {
+    {"CRC-3/ROHC",         { 3, 1, 1, 0x3,        0x7,        0x0},        0x6},
+    {"CRC-5/USB",          { 5, 1, 1, 0x05,       0x1F,       0x1F},       0x19},
+    {"CRC-7/MMC",          { 7, 0, 0, 0x09,       0x00,       0x00},       0x75},
+    {"CRC-8/SMBUS",        { 8, 0, 0, 0x07,       0x00,       0x00},       0xF4},
+    {"CRC-12/UMTS",        {12, 0, 1, 0x80F,      0x000,      0x000},      0xDAF},
+    {"CRC-16/ARC",         {16, 1, 1, 0x8005,     0x0000,     0x0000},     0xBB3D},
+    {"CRC-32/BZIP2",       {32, 0, 0, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF}, 0xFC891918},
+};
+
+// Bit-at-a-time reference, straight from the definition of the CRC model.
+static uint32_t crc_bitwise(const crc_params_t* par, const uint8_t* buf, size_t len)
+{
+    const uint32_t top = (uint32_t)1 << (par->width - 1);
+    const uint32_t mask = top | (top - 1);
+    uint32_t crc = par->init;
+
+    for (size_t i=0; i<len; i++) {
+        for (int j=0; j<8; j++) {
+            int bit = par->refin ? (buf[i] >> j) & 1 : (buf[i] >> (7 - j)) & 1;
+            int msb = (crc & top) != 0;
+            crc = (crc << 1) & mask;
+            if (msb ^ bit) {
+                crc ^= par->poly;
+            }
+        }
+    }
+    if (par->refout) {
+        uint32_t r = 0;
+        for (int j=par->width; j--;) {
+            r = (r << 1) | (crc & 1);
+            crc >>= 1;
+        }
+        crc = r;
+    }
+    return (crc ^ par->xorout) & mask;
+}
+
+static void crc_check_engine(const char* name, const crc_params_t* par, uint32_t check,
+                             const uint8_t* buf)
+{
+    static crc_engine_t eng;
+    const char str[] = "123456789";
+
+    assert(crc_engine_init(&eng, par) == 1);
+    uint32_t crc = crc_calc(&eng, (const uint8_t*)str, 9);
+    if (crc != check) {
+        printf("%s: 0x%08x (expected 0x%08x)\n", name, crc, check);
+        assert(crc == check);
+    }
+
+    // Every length and alignment, both in one pass and streamed in two pieces
+    for (size_t off=0; off<8; off++) {
+        for (size_t len=0; len<=96; len++) {
+            uint32_t ref = crc_bitwise(par, &buf[off], len);
+            assert(crc_calc(&eng, &buf[off], len) == ref);
+
+            uint32_t reg = crc_start(&eng);
+            reg = crc_update(&eng, reg, &buf[off], len / 3);
+            reg = crc_update(&eng, reg, &buf[off + len / 3], len - len / 3);
+            assert(crc_finish(&eng, reg) == ref);
+        }
+    }
+}
+
+static void crc32c_correct(void)
+{
+    static crc_engine_t eng;
+    const size_t size = 100000;
+    uint8_t* buf = malloc(size + 8);
+
+    printf("\nTesting CRC-32C engines (SSE4.2: %s):\n", crc32c_has_hw() ? "yes" : "no");
+
+    for (size_t i=size + 8; i--;) {
+        buf[i] = rand();
+    }
+
+    assert(crc32c_calc((const uint8_t*)"123456789", 9) == 0xE3069283);
+    assert(crc32c_update_sw(0, (const uint8_t*)"123456789", 9) == 0xE3069283);
+
+    crc_engine_init(&eng, &crc32_castagnoli);
+
+    for (size_t off=0; off<8; off++) {
+        for (size_t len=0; len<=1024; len++) {
+            uint32_t ref = crc_calc(&eng, &buf[off], len);
+            assert(crc32c_calc(&buf[off], len) == ref);
+            assert(crc32c_update_sw(0, &buf[off], len) == ref);
+        }
+    }
+
+    // Long enough for both of the interleaved (3 x 8 kB and 3 x 256 B) loops
+    for (int i=200; i--;) {
+        size_t off = rand() & 7;
+        size_t len = rand() % size;
+        size_t mid = rand() % (len + 1);
+        uint32_t ref = crc_calc(&eng, &buf[off], len);
+        assert(crc32c_calc(&buf[off], len) == ref);
+        assert(crc32c_update(crc32c_calc(&buf[off], mid), &buf[off + mid], len - mid) == ref);
+    }
+
+    printf("passed\n");
+
+    free(buf);
+}
+
+void crc_tb(void)
+{
+    static crc_engine_t eng;
+    uint8_t buf[1024 + 8];
+    clock_t start, end;
+    double secs;
+
+    printf("\nTesting parameterised CRC engine:\n");
+
+    for (int i=sizeof(buf); i--;) {
+        buf[i] = rand();
+    }
+
+    crc_check_engine("CRC-16/CCITT-FALSE", &crc16_ccitt_false, 0x29B1, buf);
+    crc_check_engine("CRC-16/KERMIT", &crc16_kermit, 0x2189, buf);
+    crc_check_engine("CRC-32/ISO-HDLC", &crc32_iso_hdlc, 0xCBF43926, buf);
+    crc_check_engine("CRC-32C", &crc32_castagnoli, 0xE3069283, buf);
+    crc_check_engine("CRC-32/MPEG-2", &crc32_mpeg2, 0x0376E6E7, buf);
+
+    for (int i=0; i<sizeof(configs)/sizeof(configs[0]); i++) {
+        crc_check_engine(configs[i].name, &configs[i].par, configs[i].check, buf);
+    }
+
+    // Widths that don't fit the 32-bit register are rejected
+    crc_params_t bad = crc32_mpeg2;
+    bad.width = 0;
+    assert(crc_engine_init(&eng, &bad) == 0);
+    bad.width = 33;
+    assert(crc_engine_init(&eng, &bad) == 0);
+    bad.width = 255;
+    assert(crc_engine_init(&eng, &bad) == 0);
+
+    // The STM32 routines are the specialisation of CRC-32/MPEG-2
+    crc_engine_init(&eng, &crc32_mpeg2);
+    for (size_t len=0; len<=1024; len++) {
+        assert(crc_calc(&eng, buf, len) == stm32crc_calc(buf, len));
+    }
+
+    printf("passed\n");
+
+    crc32c_correct();
+
+    printf("\nMicrobenchmarks for parameterised and CRC-32C engines (64 MB):\n\n");
+
+    uint8_t* big = malloc(1u << 20);
+    volatile uint32_t crc;
+    memset(big, 0x5a, 1u << 20);
+
+    crc_engine_init(&eng, &crc16_ccitt_false);
+    start = clock();
+    for (int i=64; i--;) {
+        crc = crc_calc(&eng, big, 1u << 20);
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tcrc_calc(CRC-16/CCITT-FALSE):\t%.3f (%.1f MB/s)\n", secs, 64.0 / (secs > 0.0 ? secs : 1e-9));
+
+    crc_engine_init(&eng, &crc32_iso_hdlc);
+    start = clock();
+    for (int i=64; i--;) {
+        crc = crc_calc(&eng, big, 1u << 20);
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tcrc_calc(CRC-32/ISO-HDLC):\t%.3f (%.1f MB/s)\n", secs, 64.0 / (secs > 0.0 ? secs : 1e-9));
+
+    start = clock();
+    for (int i=64; i--;) {
+        crc = crc32c_update_sw(0, big, 1u << 20);
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tcrc32c_update_sw():\t\t%.3f (%.1f MB/s)\n", secs, 64.0 / (secs > 0.0 ? secs : 1e-9));
+
+    start = clock();
+    for (int i=64; i--;) {
+        crc = crc32c_calc(big, 1u << 20);
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tcrc32c_calc():\t\t\t%.3f (%.1f MB/s)\n", secs, 64.0 / (secs > 0.0 ? secs : 1e-9));
+    (void)crc;
+
+    printf("\ndone\n");
+
+    free(big);
+}
@@ -0,0 +1,6 @@
+#ifndef __CRC_TB_H__
+#define __CRC_TB_H__
+
+void crc_tb(void);
+
+#endif  /* __CRC_TB_H__ */
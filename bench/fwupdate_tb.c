@@ -23,7 +23,7 @@ static uint8_t flash_erased[FLASH_PAGE_NUM];
 
 static bool flash_locked = true;
 static bool crc32_enabled = false;
-static uint32_t curr_crc = 0xfffffffful;
+static stm32crc_ctx crc_ctx = {CRC_START_32};
 static uint32_t bl_crc32 = 0;
 
 // Fake boot-ROM, for the firmware update
@@ -73,26 +73,24 @@ bool start_crc32(const uint8_t* buf, uint32_t len, uint32_t* crc)
 {
     assert(crc32_enabled == false);
     crc32_enabled = true;
-    curr_crc = stm32crc_calc(buf, len);
-    *crc = curr_crc;
+    stm32crc_init(&crc_ctx);
+    stm32crc_update(&crc_ctx, buf, len);
+    *crc = stm32crc_final(&crc_ctx);
     return true;
 }
 
 uint32_t accum_crc32(const uint8_t* buf, uint32_t len)
 {
-    uint32_t crc = curr_crc;
     assert(crc32_enabled == true);
-    for (int i=0; i<len; i++) {
-        crc = stm32crc_next(crc, buf[i]);
-    }
-    return (curr_crc = crc);
+    stm32crc_update(&crc_ctx, buf, len);
+    return stm32crc_final(&crc_ctx);
 }
 
 bool finish_crc32(void)
 {
     assert(crc32_enabled);
     crc32_enabled = false;
-    curr_crc = 0xfffffffful;
+    stm32crc_init(&crc_ctx);
     return true;
 }
 
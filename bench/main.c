@@ -2,7 +2,13 @@
 #include "strfmt_tb.h"
 #include "response_tb.h"
 #include "stm32crc_tb.h"
+#include "crc_tb.h"
 #include "fwupdate_tb.h"
+#include "mpmcq_tb.h"
+#include "rbperf_tb.h"
+#include "rbcast_tb.h"
+#include "strscan_tb.h"
+#include "strfmt_hpp_tb.h"
 
 #include <stdint.h>
 #include <stdio.h>
@@ -52,11 +58,25 @@ int main(int argc, char* argv[])
     fwupdate_tb();
     gethex_tb();
     stm32crc_tb();
+    crc_tb();
 
     ringbuf_tb();
+    batch_tb();
     bytebuf_tb();
+    zerocopy_tb();
+    record_tb();
+    spsc_tb();
+    rbpad_tb();
+    mirror_tb();
+    wait_tb();
+    overwrite_tb();
+    mpmcq_tb();
+    rbcast_tb();
+    rbperf_tb();
     response_tb();
     strfmt_tb();
+    strscan_tb();
+    strfmt_hpp_tb();
 
     return 0;
 }
@@ -0,0 +1,121 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "mpmcq.h"
+
+
+#define MPMCQ_ITEMS     8
+#define MPMCQ_SIZE      256
+#define MPMCQ_THREADS   4
+#define MPMCQ_MESSAGES  1000000
+
+MQ_MAKE_PUSH(uint32_t)
+MQ_MAKE_POP(uint32_t)
+
+
+typedef struct {
+    mpmcq_t* mq;
+    uint32_t id;
+    uint64_t sum;
+    uint32_t last[MPMCQ_THREADS];
+} mpmcq_worker_t;
+
+//
+//  Each message is the producer's ID (in the top byte), and its sequence number
+//  (from 1), so that each consumer can check that it sees the messages from each
+//  producer in order.
+///
+static void* mpmcq_producer(void* arg)
+{
+    mpmcq_worker_t* w = (mpmcq_worker_t*)arg;
+
+    for (uint32_t i=1; i<=MPMCQ_MESSAGES; ) {
+	if (mq_push(w->mq, w->id << 24 | i)) {
+	    i++;
+	} else {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+static void* mpmcq_consumer(void* arg)
+{
+    mpmcq_worker_t* w = (mpmcq_worker_t*)arg;
+    uint32_t val;
+
+    for (int i=MPMCQ_MESSAGES; i; ) {
+	if (mq_pop(w->mq, &val)) {
+	    uint32_t id = val >> 24;
+	    uint32_t seq = val & 0xffffff;
+	    assert(id < MPMCQ_THREADS && seq > w->last[id]);
+	    w->last[id] = seq;
+	    w->sum += seq;
+	    i--;
+	} else {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+
+void mpmcq_tb() {
+    void* mem = aligned_alloc(RB_CACHE_LINE, MQ_BYTES(MPMCQ_SIZE, uint32_t));
+    mpmcq_t* mq = mq_create(mem, MPMCQ_ITEMS);
+    uint32_t val;
+
+    printf("\nMPMC Queue Sanity-Checks:\n");
+
+    // Push an item, and make sure that just it can be popped.
+    assert(mq_push(mq, 666));
+    assert(mq_pop(mq, &val) && val == 666);
+    assert(!mq_pop(mq, &val));
+
+    // All of the slots can be used, and are popped in order, across the wrap.
+    for (uint32_t i=0; i<MPMCQ_ITEMS; i++) {
+	assert(mq_push(mq, i));
+    }
+    assert(!mq_push(mq, 90210));
+    assert(mq_count(mq) == MPMCQ_ITEMS);
+    for (uint32_t i=0; i<MPMCQ_ITEMS; i++) {
+	assert(mq_pop(mq, &val) && val == i);
+    }
+    assert(!mq_pop(mq, &val));
+    assert(mq_count(mq) == 0);
+
+    printf("passed\n");
+    printf("\nMPMC Queue, %d producers and %d consumers (%dM):\n",
+	   MPMCQ_THREADS, MPMCQ_THREADS, MPMCQ_THREADS * MPMCQ_MESSAGES / 1000000);
+
+    mpmcq_worker_t prod[MPMCQ_THREADS] = {0};
+    mpmcq_worker_t cons[MPMCQ_THREADS] = {0};
+    pthread_t threads[2*MPMCQ_THREADS];
+
+    mq = mq_create(mem, MPMCQ_SIZE);
+    for (int i=0; i<MPMCQ_THREADS; i++) {
+	prod[i].mq = cons[i].mq = mq;
+	prod[i].id = cons[i].id = i;
+	pthread_create(&threads[i], NULL, mpmcq_consumer, &cons[i]);
+	pthread_create(&threads[MPMCQ_THREADS + i], NULL, mpmcq_producer, &prod[i]);
+    }
+
+    uint64_t sum = 0;
+    for (int i=0; i<MPMCQ_THREADS; i++) {
+	pthread_join(threads[i], NULL);
+	pthread_join(threads[MPMCQ_THREADS + i], NULL);
+	sum += cons[i].sum;
+    }
+
+    // Every message was received exactly once
+    assert(sum == (uint64_t)MPMCQ_THREADS * MPMCQ_MESSAGES * (MPMCQ_MESSAGES + 1) / 2);
+    assert(mq_count(mq) == 0);
+
+    printf("passed\n");
+
+    free(mem);
+}
@@ -0,0 +1,21 @@
+#ifndef __MPMCQ_TB_H__
+#define __MPMCQ_TB_H__
+
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Exported functions -- //
+
+void mpmcq_tb();
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __MPMCQ_TB_H__ */
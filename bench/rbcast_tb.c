@@ -0,0 +1,141 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "rbcast.h"
+
+
+#define RBCAST_ITEMS    8
+#define RBCAST_SIZE     256
+#define RBCAST_READERS  3
+#define RBCAST_MESSAGES 1000000
+
+RBC_MAKE_PUSH(uint32_t)
+RBC_MAKE_POP(uint32_t)
+
+
+typedef struct {
+    rbcast_t* rb;
+    int32_t id;
+    int32_t count;
+    uint32_t last;
+} rbcast_reader_job_t;
+
+static rb_index_t rbcast_done;
+
+//
+//  Readers check that they see the values in (strictly increasing) order, and
+//  stop after the last value, or (in "overwrite" mode) when the writer is done,
+//  and there's nothing left.
+///
+static void* rbcast_reader(void* arg)
+{
+    rbcast_reader_job_t* job = (rbcast_reader_job_t*)arg;
+    uint32_t val;
+
+    for (;;) {
+	// Note: 'done' is loaded first, so that if it's set, then a failed pop
+	//   means that there's nothing left
+	int done = __RB_LOAD(rbcast_done, acquire);
+	if (rbc_pop(job->rb, job->id, &val)) {
+	    assert(job->count == 0 || val > job->last);
+	    job->last = val;
+	    job->count++;
+	    if (val == RBCAST_MESSAGES - 1) {
+		break;
+	    }
+	} else if (done) {
+	    break;
+	} else {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+static void rbcast_run(void* mem, int overwrite)
+{
+    rbcast_t* rb = rbc_create(mem, RBCAST_SIZE, RBCAST_READERS, overwrite);
+    rbcast_reader_job_t jobs[RBCAST_READERS];
+    pthread_t threads[RBCAST_READERS];
+
+    __RB_STORE(rbcast_done, 0, relaxed);
+    for (int i=0; i<RBCAST_READERS; i++) {
+	jobs[i].rb = rb;
+	jobs[i].id = i;
+	jobs[i].count = 0;
+	jobs[i].last = 0;
+	pthread_create(&threads[i], NULL, rbcast_reader, &jobs[i]);
+    }
+
+    for (uint32_t i=0; i<RBCAST_MESSAGES; ) {
+	if (rbc_push(rb, i)) {
+	    i++;
+	} else {
+	    assert(!overwrite);
+	    sched_yield();
+	}
+    }
+    __RB_STORE(rbcast_done, 1, release);
+
+    for (int i=0; i<RBCAST_READERS; i++) {
+	pthread_join(threads[i], NULL);
+
+	// Every value was either read, or counted as lost, exactly once
+	assert(jobs[i].last == RBCAST_MESSAGES - 1);
+	assert(jobs[i].count + rbc_lost(rb, i) == RBCAST_MESSAGES);
+	assert(overwrite || rbc_lost(rb, i) == 0);
+	assert(rbc_count(rb, i) == 0);
+	printf("reader %d: read %d, lost %u\n", i, jobs[i].count, rbc_lost(rb, i));
+    }
+}
+
+
+void rbcast_tb() {
+    void* mem = aligned_alloc(RB_CACHE_LINE, RBC_BYTES(RBCAST_SIZE, RBCAST_READERS, uint32_t));
+    rbcast_t* rb = rbc_create(mem, RBCAST_ITEMS, 2, 0);
+    uint32_t val;
+
+    printf("\nBroadcast Ring Sanity-Checks:\n");
+
+    // Each reader gets every item, and the writer waits for the slowest
+    for (uint32_t i=0; i<RBCAST_ITEMS; i++) {
+	assert(rbc_push(rb, i));
+    }
+    assert(!rbc_push(rb, 90210));
+    for (uint32_t i=0; i<RBCAST_ITEMS; i++) {
+	assert(rbc_pop(rb, 0, &val) && val == i);
+    }
+    assert(!rbc_pop(rb, 0, &val));
+    assert(!rbc_push(rb, 90210));
+    assert(rbc_pop(rb, 1, &val) && val == 0);
+    assert(rbc_push(rb, 90210));
+    assert(rbc_count(rb, 0) == 1 && rbc_count(rb, 1) == RBCAST_ITEMS);
+
+    // In "overwrite" mode, the writer never waits, and a reader that falls
+    // behind skips to the oldest item
+    rb = rbc_create(mem, RBCAST_ITEMS, 2, 1);
+    for (uint32_t i=0; i<3*RBCAST_ITEMS; i++) {
+	assert(rbc_push(rb, i));
+    }
+    assert(rbc_pop(rb, 0, &val) && val == 2*RBCAST_ITEMS + 1);
+    assert(rbc_lost(rb, 0) == 2*RBCAST_ITEMS + 1);
+    assert(rbc_lost(rb, 1) == 0);
+
+    printf("passed\n");
+
+    printf("\nBroadcast Ring, %d readers, waiting for the slowest (%dM):\n",
+	   RBCAST_READERS, RBCAST_MESSAGES / 1000000);
+    rbcast_run(mem, 0);
+    printf("passed\n");
+
+    printf("\nBroadcast Ring, %d readers, overwriting (%dM):\n",
+	   RBCAST_READERS, RBCAST_MESSAGES / 1000000);
+    rbcast_run(mem, 1);
+    printf("passed\n");
+
+    free(mem);
+}
@@ -0,0 +1,21 @@
+#ifndef __RBCAST_TB_H__
+#define __RBCAST_TB_H__
+
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Exported functions -- //
+
+void rbcast_tb();
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __RBCAST_TB_H__ */
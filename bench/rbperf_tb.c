@@ -0,0 +1,303 @@
+#define _GNU_SOURCE
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ringbuf.h"
+#include "ringbuf_wait.h"
+#include "mpmcq.h"
+
+
+//
+//  Throughput and latency of the ring-buffer variants, with the producer and
+//  the consumer pinned to different cores (when there are at least two).
+//
+//  Throughput: the producer pushes 'PERF_MESSAGES' elements, as fast as it can,
+//  and the consumer pops (and checks) them.
+//
+//  Latency: one element is "ping-ponged" between two rings, and the round-trip
+//  times are sorted to get the percentiles.
+///
+#define PERF_MESSAGES   (1 << 20)
+#define PERF_PINGS      20000
+
+#define PERF_CPU_PRODUCER 0
+#define PERF_CPU_CONSUMER 1
+
+enum {
+    PERF_PLAIN,     // ringbuf_t
+    PERF_PADDED,    // rbpad_t
+    PERF_MPMC,      // mpmcq_t
+    PERF_VARIANTS
+};
+
+static const char* perf_names[PERF_VARIANTS] = {"ringbuf_t", "rbpad_t", "mpmcq_t"};
+
+static const int32_t perf_capacities[] = {64, 1024, 16384};
+#define PERF_CAPACITIES (sizeof(perf_capacities) / sizeof(perf_capacities[0]))
+
+
+// Element types, of 8, 32, and 128 bytes, each with a sequence number
+typedef struct { uint64_t seq; } perf8_t;
+typedef struct { uint64_t seq; uint8_t pad[24]; } perf32_t;
+typedef struct { uint64_t seq; uint8_t pad[120]; } perf128_t;
+
+typedef struct {
+    int variant;
+    int cpu;
+    void* q;        // ring to push into (or to pop from, for the consumer)
+    void* r;        // ring for the replies (latency only)
+    int32_t num;
+} perf_job_t;
+
+
+// -- Helper-functions -- //
+
+static double perf_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+// Pins the calling thread to 'cpu', or (if 'cpu' is negative) to all CPUs.
+static void perf_pin(int cpu)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+
+    if (cpus > 1) {
+	CPU_ZERO(&set);
+	for (long i=0; i<cpus; i++) {
+	    if (cpu < 0 || i == cpu % cpus) {
+		CPU_SET(i, &set);
+	    }
+	}
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+}
+
+// Spins (with a "pause" hint) while the ring is full or empty, and yields now
+// and then, in case the other thread shares this core.
+static inline void perf_relax(int* spins)
+{
+    if (++*spins & 0x3f) {
+	__RB_PAUSE();
+    } else {
+	sched_yield();
+    }
+}
+
+static int perf_compare(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void* perf_create(int variant, void* mem, int32_t capacity)
+{
+    switch (variant) {
+    case PERF_PLAIN:
+	return rb_create(mem, capacity);
+    case PERF_PADDED:
+	return rbp_create(mem, capacity);
+    default:
+	return mq_create(mem, capacity);
+    }
+}
+
+
+// -- Kernels, for each element type -- //
+
+// Note: the typed 'RB_MAKE_..' macros can only make one type per file, so the
+//   kernels are made from the private macros, with a suffix for each type.
+#define PERF_MAKE(typ)                                                  \
+    static inline int perf_push_##typ(int variant, void* q, typ x)      \
+    {                                                                   \
+        if (variant == PERF_PLAIN) {                                    \
+            ringbuf_t* rb = (ringbuf_t*)q;                              \
+            __RB_PUSH(rb, typ, x);                                      \
+        } else if (variant == PERF_PADDED) {                            \
+            rbpad_t* rb = (rbpad_t*)q;                                  \
+            __RBP_PUSH(rb, typ, x);                                     \
+        } else {                                                        \
+            mpmcq_t* mq = (mpmcq_t*)q;                                  \
+            __MQ_PUSH(mq, typ, x);                                      \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    static inline int perf_pop_##typ(int variant, void* q, typ* p)      \
+    {                                                                   \
+        if (variant == PERF_PLAIN) {                                    \
+            ringbuf_t* rb = (ringbuf_t*)q;                              \
+            __RB_POP(rb, typ, p);                                       \
+        } else if (variant == PERF_PADDED) {                            \
+            rbpad_t* rb = (rbpad_t*)q;                                  \
+            __RBP_POP(rb, typ, p);                                      \
+        } else {                                                        \
+            mpmcq_t* mq = (mpmcq_t*)q;                                  \
+            __MQ_POP(mq, typ, p);                                       \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    static void* perf_producer_##typ(void* arg)                         \
+    {                                                                   \
+        perf_job_t* job = (perf_job_t*)arg;                             \
+        typ x;                                                          \
+        int spins = 0;                                                  \
+        perf_pin(job->cpu);                                             \
+        memset(&x, 0, sizeof(x));                                       \
+        for (int32_t i=0; i<job->num; i++) {                            \
+            x.seq = i;                                                  \
+            while (!perf_push_##typ(job->variant, job->q, x)) {         \
+                perf_relax(&spins);                                     \
+            }                                                           \
+        }                                                               \
+        return NULL;                                                    \
+    }                                                                   \
+                                                                        \
+    static void* perf_ponger_##typ(void* arg)                           \
+    {                                                                   \
+        perf_job_t* job = (perf_job_t*)arg;                             \
+        typ x;                                                          \
+        int spins = 0;                                                  \
+        perf_pin(job->cpu);                                             \
+        for (int32_t i=0; i<job->num; i++) {                            \
+            while (!perf_pop_##typ(job->variant, job->q, &x)) {         \
+                perf_relax(&spins);                                     \
+            }                                                           \
+            while (!perf_push_##typ(job->variant, job->r, x)) {         \
+                perf_relax(&spins);                                     \
+            }                                                           \
+        }                                                               \
+        return NULL;                                                    \
+    }                                                                   \
+                                                                        \
+    static double perf_throughput_##typ(int variant, int32_t capacity,  \
+                                        void* mem)                      \
+    {                                                                   \
+        perf_job_t job = {variant, PERF_CPU_PRODUCER, NULL, NULL, PERF_MESSAGES}; \
+        pthread_t thread;                                               \
+        typ x;                                                          \
+        int spins = 0;                                                  \
+        perf_pin(PERF_CPU_CONSUMER);                                    \
+        job.q = perf_create(variant, mem, capacity);                    \
+        double t0 = perf_now();                                         \
+        pthread_create(&thread, NULL, perf_producer_##typ, &job);       \
+        for (int32_t i=0; i<PERF_MESSAGES; i++) {                       \
+            while (!perf_pop_##typ(variant, job.q, &x)) {               \
+                perf_relax(&spins);                                     \
+            }                                                           \
+            assert(x.seq == (uint64_t)i);                               \
+        }                                                               \
+        double t1 = perf_now();                                         \
+        pthread_join(thread, NULL);                                     \
+        return PERF_MESSAGES / (t1 - t0);                               \
+    }                                                                   \
+                                                                        \
+    static void perf_latency_##typ(int variant, void* mem, void* mem2,  \
+                                   double* rtt)                         \
+    {                                                                   \
+        perf_job_t job = {variant, PERF_CPU_CONSUMER, NULL, NULL, PERF_PINGS}; \
+        pthread_t thread;                                               \
+        typ x;                                                          \
+        int spins = 0;                                                  \
+        perf_pin(PERF_CPU_PRODUCER);                                    \
+        job.q = perf_create(variant, mem, perf_capacities[0]);          \
+        job.r = perf_create(variant, mem2, perf_capacities[0]);         \
+        memset(&x, 0, sizeof(x));                                       \
+        pthread_create(&thread, NULL, perf_ponger_##typ, &job);         \
+        for (int32_t i=0; i<PERF_PINGS; i++) {                          \
+            x.seq = i;                                                  \
+            double t0 = perf_now();                                     \
+            while (!perf_push_##typ(variant, job.q, x)) {               \
+                perf_relax(&spins);                                     \
+            }                                                           \
+            while (!perf_pop_##typ(variant, job.r, &x)) {               \
+                perf_relax(&spins);                                     \
+            }                                                           \
+            rtt[i] = perf_now() - t0;                                   \
+            assert(x.seq == (uint64_t)i);                               \
+        }                                                               \
+        pthread_join(thread, NULL);                                     \
+    }
+
+PERF_MAKE(perf8_t)
+PERF_MAKE(perf32_t)
+PERF_MAKE(perf128_t)
+
+
+// -- Exported functions -- //
+
+void rbperf_tb() {
+    const size_t bytes = MQ_BYTES(16384, perf128_t);
+    void* mem = aligned_alloc(RB_CACHE_LINE, bytes);
+    void* mem2 = aligned_alloc(RB_CACHE_LINE, bytes);
+    double* rtt = malloc(PERF_PINGS * sizeof(double));
+
+    static const size_t sizes[] = {sizeof(perf8_t), sizeof(perf32_t), sizeof(perf128_t)};
+
+    printf("\nRing-buffer throughput, across threads (%dM messages, on %ld CPU(s)):\n\n",
+	   PERF_MESSAGES >> 20, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-10s %6s %8s %10s %10s\n", "variant", "bytes", "capacity", "Mmsg/s", "MB/s");
+
+    for (int v=0; v<PERF_VARIANTS; v++) {
+	for (int s=0; s<3; s++) {
+	    for (int c=0; c<PERF_CAPACITIES; c++) {
+		double rate;
+		switch (s) {
+		case 0:
+		    rate = perf_throughput_perf8_t(v, perf_capacities[c], mem);
+		    break;
+		case 1:
+		    rate = perf_throughput_perf32_t(v, perf_capacities[c], mem);
+		    break;
+		default:
+		    rate = perf_throughput_perf128_t(v, perf_capacities[c], mem);
+		    break;
+		}
+		printf("%-10s %6zu %8d %10.2f %10.1f\n", perf_names[v], sizes[s],
+		       perf_capacities[c], 1e-6 * rate, 1e-6 * rate * sizes[s]);
+	    }
+	}
+    }
+
+    printf("\nRing-buffer round-trip latency (%d pings, capacity %d):\n\n",
+	   PERF_PINGS, perf_capacities[0]);
+    printf("%-10s %6s %10s %10s %10s\n", "variant", "bytes", "p50 (ns)", "p99 (ns)", "p99.9 (ns)");
+
+    for (int v=0; v<PERF_VARIANTS; v++) {
+	for (int s=0; s<3; s++) {
+	    switch (s) {
+	    case 0:
+		perf_latency_perf8_t(v, mem, mem2, rtt);
+		break;
+	    case 1:
+		perf_latency_perf32_t(v, mem, mem2, rtt);
+		break;
+	    default:
+		perf_latency_perf128_t(v, mem, mem2, rtt);
+		break;
+	    }
+	    qsort(rtt, PERF_PINGS, sizeof(double), perf_compare);
+	    printf("%-10s %6zu %10.0f %10.0f %10.0f\n", perf_names[v], sizes[s],
+		   1e9 * rtt[PERF_PINGS / 2],
+		   1e9 * rtt[PERF_PINGS * 99 / 100],
+		   1e9 * rtt[PERF_PINGS * 999 / 1000]);
+	}
+    }
+
+    printf("\ndone\n");
+
+    perf_pin(-1);
+    free(rtt);
+    free(mem2);
+    free(mem);
+}
@@ -0,0 +1,21 @@
+#ifndef __RBPERF_TB_H__
+#define __RBPERF_TB_H__
+
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Exported functions -- //
+
+void rbperf_tb();
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __RBPERF_TB_H__ */
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 
 #include "ringbuf.h"
 #include "strfmt.h"
@@ -66,6 +67,78 @@ void ringbuf_tb() {
 }
 
 
+//
+//  Tests for batched pushes and pops, of blocks of ADC-like samples.
+///
+#define BATCH_ITEMS   1024
+#define BATCH_BLOCK   256
+#define BATCH_TOTAL   (1 << 28)
+
+void batch_tb() {
+    void* rb_mem = malloc(sizeof(ringbuf_t) + BATCH_ITEMS*sizeof(int32_t));
+    ringbuf_t* rb = rb_create(rb_mem, BATCH_ITEMS);
+    int32_t block[BATCH_BLOCK];
+    int32_t sent = 0;
+    int32_t recv = 0;
+    int32_t val;
+
+    printf("\nRingbuf batched pushes and pops (1M blocks):\n");
+
+    for (int i=1000000; i--;) {
+	int mode = rand();
+	int32_t length = mode & (BATCH_BLOCK - 1);
+	int32_t n;
+
+	if (mode & BATCH_BLOCK) {
+	    for (int j=0; j<length; j++) {
+		block[j] = sent + j;
+	    }
+	    n = rb_push_n(rb, block, length);
+	    assert(n >= 0 && n <= length);
+	    sent += n;
+	} else {
+	    n = rb_pop_n(rb, block, length);
+	    assert(n >= 0 && n <= length);
+	    for (int j=0; j<n; j++) {
+		assert(block[j] == recv++);
+	    }
+	}
+	assert(rb_count(rb) == sent - recv);
+    }
+
+    // Single and batched operations can be mixed
+    while (rb_pop(rb, &val)) {
+	assert(val == recv++);
+    }
+    assert(sent == recv);
+
+    printf("passed\n");
+    printf("\nRingbuf single vs batched (%d-sample blocks, %dM samples):\n",
+	   BATCH_BLOCK, BATCH_TOTAL >> 20);
+
+    clock_t t0 = clock();
+    for (int32_t total=0; total<BATCH_TOTAL; total+=BATCH_BLOCK) {
+	for (int j=0; j<BATCH_BLOCK; j++) {
+	    rb_push(rb, block[j]);
+	}
+	for (int j=0; j<BATCH_BLOCK; j++) {
+	    rb_pop(rb, &block[j]);
+	}
+    }
+    clock_t t1 = clock();
+    for (int32_t total=0; total<BATCH_TOTAL; total+=BATCH_BLOCK) {
+	rb_push_n(rb, block, BATCH_BLOCK);
+	rb_pop_n(rb, block, BATCH_BLOCK);
+    }
+    clock_t t2 = clock();
+
+    printf("rb_push/rb_pop:     %.1f M/s\n", 1e-6 * BATCH_TOTAL * CLOCKS_PER_SEC / (t1 - t0));
+    printf("rb_push_n/rb_pop_n: %.1f M/s\n", 1e-6 * BATCH_TOTAL * CLOCKS_PER_SEC / (t2 - t1));
+
+    free(rb_mem);
+}
+
+
 //
 //  Tests for a buffer of bytes, with chunked reads & writes.
 ///
@@ -117,3 +190,630 @@ void bytebuf_tb() {
     free(chunk);
     free(bb_mem);
 }
+
+
+//
+//  Tests for zero-copy reads & writes, directly into (and from) the buffer.
+///
+void zerocopy_tb() {
+    void* bb_mem = malloc(sizeof(ringbuf_t) + BYTEBUF_BYTES);
+    ringbuf_t* rb = rb_create(bb_mem, BYTEBUF_BYTES);
+    const uint8_t* src;
+    uint8_t* dst;
+    uint8_t sent = 0;
+    uint8_t recv = 0;
+    int32_t count = 0;
+
+    printf("\nBytebuf zero-copy reserves and peeks (10M chunks):\n");
+
+    // An empty buffer has all but one byte free, but only to the end
+    assert(rb_peek(rb, &src) == 0);
+    assert(rb_reserve(rb, &dst, BYTEBUF_BYTES) == BYTEBUF_BYTES-1);
+    assert(rb_commit(rb, 100) == 100);
+    assert(rb_peek(rb, &src) == 100);
+    assert(rb_consume(rb, 100) == 100);
+    assert(rb_reserve(rb, &dst, BYTEBUF_BYTES) == BYTEBUF_BYTES-100);
+    rb_clear(rb);
+
+    for (int i=10000000; i--;) {
+	int mode = rand();
+	int32_t length = mode & 0x0ff;
+	int32_t n;
+
+	if (mode & 0x100) {
+	    n = rb_reserve(rb, &dst, length);
+	    assert(n >= 0 && n <= length && n <= BYTEBUF_BYTES-1-count);
+	    assert(dst + n <= (uint8_t*)rb->data + BYTEBUF_BYTES);
+	    for (int j=0; j<n; j++) {
+		dst[j] = sent++;
+	    }
+	    count += rb_commit(rb, n);
+	} else {
+	    n = rb_peek(rb, &src);
+	    assert(n >= 0 && n <= count);
+	    assert(src + n <= (uint8_t*)rb->data + BYTEBUF_BYTES);
+	    n = n < length ? n : length;
+	    for (int j=0; j<n; j++) {
+		assert(src[j] == recv++);
+	    }
+	    count -= rb_consume(rb, n);
+	}
+	assert(count == rb_count(rb));
+    }
+
+    printf("passed\n");
+
+    free(bb_mem);
+}
+
+
+//
+//  Concurrency tests, with a producer thread and a consumer thread.
+///
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define SPSC_ITEMS    64
+#define SPSC_MESSAGES 10000000
+#define SPSC_BYTES    (64 << 20)
+
+static double spsc_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static void* spsc_producer(void* arg)
+{
+    ringbuf_t* rb = (ringbuf_t*)arg;
+
+    for (int32_t i=0; i<SPSC_MESSAGES; ) {
+	if (rb_push(rb, i)) {
+	    i++;
+	} else {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+static void* bytes_producer(void* arg)
+{
+    ringbuf_t* rb = (ringbuf_t*)arg;
+    uint8_t chunk[256];
+    uint32_t seed = 1;
+    int32_t sent = 0;
+
+    while (sent < SPSC_BYTES) {
+	int32_t length = rand_r(&seed) & 0x0ff;
+	if (length > SPSC_BYTES - sent) {
+	    length = SPSC_BYTES - sent;
+	}
+	for (int j=0; j<length; j++) {
+	    chunk[j] = (uint8_t)(sent + j);
+	}
+	int32_t count = length;
+	while (count > 0) {
+	    int32_t n = rb_copy(rb, chunk + length - count, count);
+	    if (n == 0) {
+		sched_yield();
+	    }
+	    count -= n;
+	}
+	sent += length;
+    }
+    return NULL;
+}
+
+void spsc_tb() {
+    void* rb_mem = malloc(sizeof(ringbuf_t) + SPSC_ITEMS*sizeof(int32_t));
+    ringbuf_t* rb = rb_create(rb_mem, SPSC_ITEMS);
+    pthread_t thread;
+    int32_t val;
+
+    printf("\nRingbuf SPSC pushes and pops, across threads (10M):\n");
+
+    double t0 = spsc_now();
+    pthread_create(&thread, NULL, spsc_producer, rb);
+    for (int32_t i=0; i<SPSC_MESSAGES; ) {
+	if (rb_pop(rb, &val)) {
+	    assert(val == i);
+	    i++;
+	} else {
+	    sched_yield();
+	}
+    }
+    pthread_join(thread, NULL);
+    assert(rb_count(rb) == 0);
+
+    printf("passed (%.1f M/s)\n", 1e-6 * SPSC_MESSAGES / (spsc_now() - t0));
+    free(rb_mem);
+
+    printf("\nBytebuf SPSC copies and takes, across threads (64 MB):\n");
+
+    void* bb_mem = malloc(sizeof(ringbuf_t) + BYTEBUF_BYTES);
+    rb = rb_create(bb_mem, BYTEBUF_BYTES);
+    uint8_t chunk[256];
+
+    pthread_create(&thread, NULL, bytes_producer, rb);
+    for (int32_t recv=0; recv<SPSC_BYTES; ) {
+	int32_t count = rb_take(rb, chunk, rand() & 0x0ff);
+	for (int j=0; j<count; j++) {
+	    assert(chunk[j] == (uint8_t)(recv + j));
+	}
+	if (count == 0) {
+	    sched_yield();
+	}
+	recv += count;
+    }
+    pthread_join(thread, NULL);
+    assert(rb_count(rb) == 0);
+
+    printf("passed\n");
+    free(bb_mem);
+}
+
+
+//
+//  Tests for the padded ring-buffer, with a cached remote index.
+///
+RBP_MAKE_PUSH(int32_t)
+RBP_MAKE_POP(int32_t)
+
+static void* rbpad_producer(void* arg)
+{
+    rbpad_t* rb = (rbpad_t*)arg;
+
+    for (int32_t i=0; i<SPSC_MESSAGES; ) {
+	if (rbp_push(rb, i)) {
+	    i++;
+	} else {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+static void* rbpad_bytes_producer(void* arg)
+{
+    rbpad_t* rb = (rbpad_t*)arg;
+    uint8_t chunk[256];
+    uint32_t seed = 1;
+    int32_t sent = 0;
+
+    while (sent < SPSC_BYTES) {
+	int32_t length = rand_r(&seed) & 0x0ff;
+	if (length > SPSC_BYTES - sent) {
+	    length = SPSC_BYTES - sent;
+	}
+	for (int j=0; j<length; j++) {
+	    chunk[j] = (uint8_t)(sent + j);
+	}
+	int32_t count = length;
+	while (count > 0) {
+	    int32_t n = rbp_copy(rb, chunk + length - count, count);
+	    if (n == 0) {
+		sched_yield();
+	    }
+	    count -= n;
+	}
+	sent += length;
+    }
+    return NULL;
+}
+
+void rbpad_tb() {
+    assert(sizeof(rbpad_t) == 2*RB_CACHE_LINE);
+    void* rb_mem = aligned_alloc(RB_CACHE_LINE, sizeof(rbpad_t) + SPSC_ITEMS*sizeof(int32_t));
+    rbpad_t* rb = rbp_create(rb_mem, RINGBUF_ITEMS);
+    pthread_t thread;
+    int32_t val;
+
+    printf("\nRbpad Sanity-Checks:\n");
+
+    rbp_push(rb, 666);
+    assert(rbp_pop(rb, &val) && val == 666);
+    assert(!rbp_pop(rb, &val));
+
+    for (int i=0; i<RINGBUF_ITEMS-1; i++) {
+	assert(rbp_push(rb, i));
+    }
+    assert(!rbp_push(rb, 90210));
+    assert(rbp_pop(rb, &val) && val == 0);
+    assert(rbp_push(rb, 90210));
+    assert(rbp_count(rb) == RINGBUF_ITEMS-1 && rbp_space(rb) == 0);
+
+    rbp_clear(rb);
+    assert(!rbp_pop(rb, &val));
+    assert(rbp_push(rb, 90210));
+
+    printf("passed\n");
+    printf("\nRbpad SPSC pushes and pops, across threads (10M):\n");
+
+    rb = rbp_create(rb_mem, SPSC_ITEMS);
+    double t0 = spsc_now();
+    pthread_create(&thread, NULL, rbpad_producer, rb);
+    for (int32_t i=0; i<SPSC_MESSAGES; ) {
+	if (rbp_pop(rb, &val)) {
+	    assert(val == i);
+	    i++;
+	} else {
+	    sched_yield();
+	}
+    }
+    pthread_join(thread, NULL);
+    assert(rbp_count(rb) == 0);
+
+    printf("passed (%.1f M/s)\n", 1e-6 * SPSC_MESSAGES / (spsc_now() - t0));
+    free(rb_mem);
+
+    printf("\nRbpad SPSC copies and takes, across threads (64 MB):\n");
+
+    void* bb_mem = aligned_alloc(RB_CACHE_LINE, sizeof(rbpad_t) + BYTEBUF_BYTES);
+    rb = rbp_create(bb_mem, BYTEBUF_BYTES);
+    uint8_t chunk[256];
+
+    pthread_create(&thread, NULL, rbpad_bytes_producer, rb);
+    for (int32_t recv=0; recv<SPSC_BYTES; ) {
+	int32_t count = rbp_take(rb, chunk, rand() & 0x0ff);
+	for (int j=0; j<count; j++) {
+	    assert(chunk[j] == (uint8_t)(recv + j));
+	}
+	if (count == 0) {
+	    sched_yield();
+	}
+	recv += count;
+    }
+    pthread_join(thread, NULL);
+    assert(rbp_count(rb) == 0);
+
+    printf("passed\n");
+    free(bb_mem);
+}
+
+
+//
+//  Tests for the mirrored (double-mapped) ring-buffer, and a comparison of its
+//  streaming throughput, against the split copies of 'rb_copy(..)'.
+///
+#define MIRROR_BYTES  (64 << 10)
+#define MIRROR_CHUNK  (24 << 10)
+#define MIRROR_TOTAL  ((int64_t)1 << 30)
+
+static double mirror_bench(ringbuf_t* rb, uint8_t* chunk, int mirrored)
+{
+    double t0 = spsc_now();
+
+    for (int64_t total=0; total<MIRROR_TOTAL; total+=MIRROR_CHUNK) {
+	if (mirrored) {
+	    rbm_copy(rb, chunk, MIRROR_CHUNK);
+	    rbm_take(rb, chunk, MIRROR_CHUNK);
+	} else {
+	    rb_copy(rb, chunk, MIRROR_CHUNK);
+	    rb_take(rb, chunk, MIRROR_CHUNK);
+	}
+    }
+    return 1e-9 * MIRROR_TOTAL / (spsc_now() - t0);
+}
+
+void mirror_tb() {
+    ringbuf_t* rb = rb_mirror_create(MIRROR_BYTES);
+    uint8_t* chunk = malloc(MIRROR_CHUNK);
+    volatile uint8_t* data;
+    uint8_t sent = 0;
+    uint8_t recv = 0;
+    int32_t count = 0;
+
+    printf("\nMirrored Bytebuf Sanity-Checks (1M chunks):\n");
+
+    assert(rb != NULL);
+    assert(rb_mirror_create(MIRROR_BYTES + 1) == NULL);
+
+    // Both halves of the mapping are the same memory (which the compiler can't
+    // know, hence 'volatile')
+    data = (volatile uint8_t*)rb->data;
+    data[0] = 0x5a;
+    assert(data[MIRROR_BYTES] == 0x5a);
+    data[2*MIRROR_BYTES - 1] = 0xa5;
+    assert(data[MIRROR_BYTES - 1] == 0xa5);
+
+    for (int i=1000000; i--;) {
+	int mode = rand();
+	int32_t length = mode & 0x0fff;
+	int32_t n;
+
+	if (mode & 0x1000) {
+	    for (int j=0; j<length; j++) {
+		chunk[j] = (uint8_t)(sent + j);
+	    }
+	    n = rbm_copy(rb, chunk, length);
+	    sent += n;
+	    count += n;
+	} else if (mode & 0x2000) {
+	    n = rbm_take(rb, chunk, length);
+	    for (int j=0; j<n; j++) {
+		assert(chunk[j] == recv++);
+	    }
+	    count -= n;
+	} else {
+	    n = rb_drop(rb, length);
+	    recv += n;
+	    count -= n;
+	}
+	assert(count == rb_count(rb));
+    }
+
+    printf("passed\n");
+    printf("\nMirrored Bytebuf streaming (1 GB, %d kB chunks):\n", MIRROR_CHUNK >> 10);
+
+    rb_clear(rb);
+    printf("rb_copy/rb_take:   %.2f GB/s\n", mirror_bench(rb, chunk, 0));
+    printf("rbm_copy/rbm_take: %.2f GB/s\n", mirror_bench(rb, chunk, 1));
+
+    rb_mirror_destroy(rb);
+    free(chunk);
+}
+
+
+//
+//  Tests for blocking pushes and pops, where the consumer is sometimes idle.
+///
+#include <unistd.h>
+#include "ringbuf_wait.h"
+
+#define WAIT_ITEMS    16
+#define WAIT_MESSAGES 1000000
+
+RB_MAKE_PUSH_WAIT(int32_t)
+RB_MAKE_POP_WAIT(int32_t)
+
+static void* wait_producer(void* arg)
+{
+    ringbuf_wait_t* rw = (ringbuf_wait_t*)arg;
+
+    for (int32_t i=0; i<WAIT_MESSAGES; i++) {
+	rb_push_wait(rw, i);
+    }
+
+    // Then, after a pause (so that the consumer goes to sleep), one more
+    usleep(20000);
+    rb_push_wait(rw, -1);
+    return NULL;
+}
+
+void wait_tb() {
+    void* rb_mem = malloc(sizeof(ringbuf_wait_t) + WAIT_ITEMS*sizeof(int32_t));
+    ringbuf_wait_t* rw = rbw_create(rb_mem, WAIT_ITEMS);
+    pthread_t thread;
+    int32_t val;
+
+    printf("\nRingbuf blocking pushes and pops, across threads (1M):\n");
+
+    pthread_create(&thread, NULL, wait_producer, rw);
+    for (int32_t i=0; i<WAIT_MESSAGES; i++) {
+	rb_pop_wait(rw, &val);
+	assert(val == i);
+    }
+    rb_pop_wait(rw, &val);
+    assert(val == -1);
+    pthread_join(thread, NULL);
+
+    assert(rb_count(&rw->rb) == 0);
+    assert(__RB_LOAD(rw->push_waiters, relaxed) == 0);
+    assert(__RB_LOAD(rw->pop_waiters, relaxed) == 0);
+
+    printf("passed\n");
+
+    free(rb_mem);
+}
+
+
+//
+//  Tests for the "overwrite" (flight-recorder) mode, where the producer never
+//  waits, and the oldest items are dropped.
+///
+#define OVER_MESSAGES 1000000
+
+RB_MAKE_PUSH_OVERWRITE(int32_t)
+RB_MAKE_POP_CHECKED(int32_t)
+
+static rb_index_t over_done;
+static uint32_t over_dropped;
+
+static void* over_producer(void* arg)
+{
+    ringbuf_t* rb = (ringbuf_t*)arg;
+
+    for (int32_t i=0; i<OVER_MESSAGES; i++) {
+	rb_push_over(rb, i, &over_dropped);
+	if ((i & 0xff) == 0) {
+	    sched_yield();
+	}
+    }
+    __RB_STORE(over_done, 1, release);
+    return NULL;
+}
+
+void overwrite_tb() {
+    void* rb_mem = malloc(sizeof(ringbuf_t) + SPSC_ITEMS*sizeof(int32_t));
+    ringbuf_t* rb = rb_create(rb_mem, RINGBUF_ITEMS);
+    pthread_t thread;
+    uint32_t dropped = 0;
+    int32_t val;
+
+    printf("\nRingbuf overwrite-oldest Sanity-Checks:\n");
+
+    // The newest 'n-1' items are kept
+    for (int32_t i=0; i<20; i++) {
+	assert(rb_push_over(rb, i, &dropped) == (i >= RINGBUF_ITEMS-1));
+    }
+    assert(dropped == 20 - (RINGBUF_ITEMS-1));
+    assert(rb_count(rb) == RINGBUF_ITEMS-1);
+    for (int32_t i=20-(RINGBUF_ITEMS-1); i<20; i++) {
+	assert(rb_pop_checked(rb, &val) && val == i);
+    }
+    val = -1;
+    assert(!rb_pop_checked(rb, &val) && val == -1);
+    assert(rb_push_over(rb, 666, NULL) == 0);
+
+    // The free-running 'tail' goes past INT32_MAX (to INT32_MIN)
+    rb_create(rb_mem, RINGBUF_ITEMS);
+    __RB_STORE(rb->tail, INT32_MAX - 2, relaxed);
+    __RB_STORE(rb->head, (INT32_MAX - 2) & rb->wrap, relaxed);
+    dropped = 0;
+    for (int32_t i=0; i<20; i++) {
+	assert(rb_push_over(rb, i, &dropped) == (i >= RINGBUF_ITEMS-1));
+	assert(rb_count(rb) == (i < RINGBUF_ITEMS-1 ? i + 1 : RINGBUF_ITEMS-1));
+    }
+    assert(dropped == 20 - (RINGBUF_ITEMS-1));
+    assert(__RB_LOAD(rb->tail, relaxed) < 0);
+    for (int32_t i=20-(RINGBUF_ITEMS-1); i<20; i++) {
+	assert(rb_pop_checked(rb, &val) && val == i);
+    }
+    assert(!rb_pop_checked(rb, &val) && rb_count(rb) == 0);
+
+    printf("passed\n");
+    printf("\nRingbuf overwrite-oldest, across threads (1M):\n");
+
+    rb = rb_create(rb_mem, SPSC_ITEMS);
+    __RB_STORE(over_done, 0, relaxed);
+    over_dropped = 0;
+
+    pthread_create(&thread, NULL, over_producer, rb);
+    int32_t count = 0;
+    int32_t last = -1;
+    for (;;) {
+	int done = __RB_LOAD(over_done, acquire);
+	if (rb_pop_checked(rb, &val)) {
+	    assert(val > last);
+	    last = val;
+	    count++;
+	} else if (done) {
+	    break;
+	}
+    }
+    pthread_join(thread, NULL);
+
+    // Every item was either popped, or dropped, exactly once
+    assert(last == OVER_MESSAGES-1);
+    assert(count + over_dropped == OVER_MESSAGES);
+
+    printf("passed (popped %d, dropped %u)\n", count, over_dropped);
+    free(rb_mem);
+}
+
+
+//
+//  Tests for length-prefixed records, which are always contiguous, and are only
+//  seen whole.
+///
+#define RECORD_BYTES    1024
+#define RECORD_MESSAGES 1000000
+
+// Record 'i' has a length of 'i % 300' bytes (so some don't fit), of 'i + j'
+static int32_t record_make(uint8_t* rec, int32_t i)
+{
+    int32_t len = i % 300;
+    for (int j=0; j<len; j++) {
+	rec[j] = (uint8_t)(i + j);
+    }
+    return len;
+}
+
+static void record_check(const uint8_t* rec, int32_t len, int32_t i)
+{
+    assert(len == i % 300);
+    for (int j=0; j<len; j++) {
+	assert(rec[j] == (uint8_t)(i + j));
+    }
+}
+
+static void* record_producer(void* arg)
+{
+    ringbuf_t* rb = (ringbuf_t*)arg;
+    uint8_t rec[300];
+
+    for (int32_t i=0; i<RECORD_MESSAGES; i++) {
+	int32_t len = record_make(rec, i);
+	if (RB_RECORD_BYTES(len) > RECORD_BYTES / 2) {
+	    assert(rb_put_record(rb, rec, len) == RB_RECORD_NONE);
+	    continue;
+	}
+	while (rb_put_record(rb, rec, len) == RB_RECORD_NONE) {
+	    sched_yield();
+	}
+    }
+    return NULL;
+}
+
+void record_tb() {
+    void* bb_mem = malloc(sizeof(ringbuf_t) + RECORD_BYTES);
+    ringbuf_t* rb = rb_create(bb_mem, RECORD_BYTES);
+    const uint8_t* ptr;
+    uint8_t rec[300];
+    pthread_t thread;
+
+    printf("\nBytebuf record Sanity-Checks:\n");
+
+    assert(rb_peek_record(rb, &ptr) == RB_RECORD_NONE && ptr == NULL);
+    assert(rb_put_record(rb, (const uint8_t*)"hello", 5) == 5);
+    assert(rb_put_record(rb, NULL, 0) == 0);
+    assert(rb_put_record(rb, NULL, -1) == RB_RECORD_NONE);
+    assert(rb_put_record(rb, NULL, INT32_MAX) == RB_RECORD_NONE);
+    assert(rb_put_record(rb, NULL, INT32_MAX - 2) == RB_RECORD_NONE);
+    assert(rb_count(rb) == RB_RECORD_BYTES(5) + RB_RECORD_BYTES(0));
+    assert(rb_get_record(rb, rec, 4) == RB_RECORD_TOO_BIG);
+    assert(rb_peek_record(rb, &ptr) == 5 && memcmp(ptr, "hello", 5) == 0);
+    assert(rb_get_record(rb, rec, sizeof(rec)) == 5);
+    assert(rb_get_record(rb, rec, sizeof(rec)) == 0);
+    assert(rb_get_record(rb, rec, sizeof(rec)) == RB_RECORD_NONE);
+
+    // Records that would wrap are moved to the start of the buffer
+    for (int32_t i=0; i<1000; i++) {
+	int32_t len = record_make(rec, i) % 200;
+	assert(rb_put_record(rb, rec, len) == len);
+	assert(rb_peek_record(rb, &ptr) == len);
+	assert(ptr + len <= (uint8_t*)rb->data + RECORD_BYTES);
+	assert(memcmp(ptr, rec, len) == 0);
+	assert(rb_drop_record(rb) == len);
+	assert(rb_count(rb) == 0);
+    }
+
+    // A full buffer rejects even an empty record, which is then distinct from
+    // a successful one
+    while (rb_put_record(rb, NULL, 0) == 0) {
+    }
+    assert(rb_space(rb) < RB_RECORD_BYTES(0) * 2);
+    assert(rb_put_record(rb, NULL, 0) == RB_RECORD_NONE);
+    while (rb_drop_record(rb) == 0) {
+    }
+    assert(rb_count(rb) == 0);
+
+    printf("passed\n");
+    printf("\nBytebuf records, across threads (1M):\n");
+
+    rb_clear(rb);
+    pthread_create(&thread, NULL, record_producer, rb);
+    for (int32_t i=0; i<RECORD_MESSAGES; ) {
+	int32_t len = i % 300;
+	if (RB_RECORD_BYTES(len) > RECORD_BYTES / 2) {
+	    i++;
+	    continue;
+	}
+	len = rb_peek_record(rb, &ptr);
+	if (len == RB_RECORD_NONE) {
+	    sched_yield();
+	    continue;
+	}
+	record_check(ptr, len, i);
+	assert(rb_drop_record(rb) == len);
+	i++;
+    }
+    pthread_join(thread, NULL);
+    assert(rb_count(rb) == 0);
+
+    printf("passed\n");
+    free(bb_mem);
+}
@@ -11,7 +11,15 @@ extern "C"
 // -- Exported functions -- //
 
 void ringbuf_tb();
+void batch_tb();
 void bytebuf_tb();
+void zerocopy_tb();
+void record_tb();
+void spsc_tb();
+void rbpad_tb();
+void mirror_tb();
+void wait_tb();
+void overwrite_tb();
 
 
 #ifdef __cplusplus
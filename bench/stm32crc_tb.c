@@ -1,8 +1,313 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include "stm32crc.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+// Sweep from 16 B to 64 MB, processing about 8 MB per measurement
+#define CRC_SWEEP_MIN   ((size_t)16)
+#define CRC_SWEEP_MAX   ((size_t)64 << 20)
+#define CRC_SWEEP_BYTES ((size_t)8 << 20)
+
+
+typedef uint32_t (*stm32crc_fn)(const unsigned char *, size_t);
+
+static uint32_t crc_reference(const uint8_t* buf, size_t len)
+{
+    uint32_t crc = CRC_START_32;
+    for (size_t i=0; i<len; i++) {
+        crc = stm32crc_next(crc, buf[i]);
+    }
+    return crc;
+}
+
+static void stm32crc_variants_correct(void)
+{
+    static const stm32crc_fn fns[] = {
+        stm32crc_calc_bytewise,
+        stm32crc_calc_slice8,
+        stm32crc_calc_slice16,
+        stm32crc_calc_clmul,
+        stm32crc_calc,
+    };
+    uint8_t buf[1024 + 16];
+
+    printf("\nTesting CRC32 variants for bit-identical results:\n");
+
+    for (int i=sizeof(buf); i--;) {
+        buf[i] = rand();
+    }
+
+    // All lengths (covering every tail-length), and all alignments
+    for (size_t off=0; off<16; off++) {
+        for (size_t len=0; len<=1024; len++) {
+            uint32_t ref = crc_reference(&buf[off], len);
+            for (int k=sizeof(fns)/sizeof(fns[0]); k--;) {
+                assert(fns[k](&buf[off], len) == ref);
+            }
+        }
+    }
+
+    printf("passed\n");
+}
+
+static void stm32crc_combine_correct(void)
+{
+    const size_t size = 3u << 20;
+    uint8_t* buf = malloc(size);
+
+    printf("\nTesting CRC32 combine, streaming, and multi-threaded calculation:\n");
+
+    for (size_t i=size; i--;) {
+        buf[i] = rand();
+    }
+
+    // Every split-point of a short string, including the empty halves
+    for (size_t len=0; len<=256; len++) {
+        uint32_t ref = stm32crc_calc(buf, len);
+        for (size_t a=0; a<=len; a++) {
+            uint32_t crc_a = stm32crc_calc(buf, a);
+            uint32_t crc_b = stm32crc_calc(&buf[a], len - a);
+            assert(stm32crc_combine(crc_a, crc_b, len - a) == ref);
+        }
+    }
+
+    // Random splits of long strings
+    for (int i=100; i--;) {
+        size_t len = rand() % size;
+        size_t a = rand() % (len + 1);
+        uint32_t crc_a = stm32crc_calc(buf, a);
+        uint32_t crc_b = stm32crc_calc(&buf[a], len - a);
+        assert(stm32crc_combine(crc_a, crc_b, len - a) == stm32crc_calc(buf, len));
+    }
+
+    // Streaming updates, with random chunk-sizes
+    for (int i=100; i--;) {
+        size_t len = rand() % size;
+        stm32crc_ctx ctx;
+        stm32crc_init(&ctx);
+        for (size_t off=0, n; off<len; off+=n) {
+            n = rand() % (i < 50 ? 300 : 100000);
+            n = n > len - off ? len - off : n;
+            stm32crc_update(&ctx, &buf[off], n);
+        }
+        assert(stm32crc_final(&ctx) == stm32crc_calc(buf, len));
+    }
+
+    for (int n=0; n<=9; n++) {
+        assert(stm32crc_calc_parallel(buf, size, n) == stm32crc_calc(buf, size));
+        assert(stm32crc_calc_parallel(buf + 1, size - 77, n) == stm32crc_calc(buf + 1, size - 77));
+        assert(stm32crc_calc_parallel(buf, 1000, n) == stm32crc_calc(buf, 1000));
+    }
+    assert(stm32crc_calc_parallel(NULL, 0, 4) == CRC_START_32);
+
+    printf("passed\n");
+
+    free(buf);
+}
+
+static void stm32crc_multi_correct(void)
+{
+    enum { NUM = 67 };
+    static uint8_t pool[NUM][1040];
+    const uint8_t* bufs[NUM];
+    size_t lens[NUM];
+    uint32_t crcs[NUM];
+
+    printf("\nTesting CRC32 multi-buffer calculation:\n");
+
+    for (int i=NUM; i--;) {
+        for (int j=sizeof(pool[i]); j--;) {
+            pool[i][j] = rand();
+        }
+    }
+
+    for (int k=2000; k--;) {
+        // Mostly similar lengths, with the occasional short or empty buffer
+        size_t base = rand() % 1024;
+        for (int i=NUM; i--;) {
+            bufs[i] = &pool[i][rand() & 15];
+            lens[i] = (rand() & 7) ? base + (rand() & 15) : rand() % 40;
+        }
+        bufs[k % NUM] = k & 1 ? NULL : bufs[k % NUM];
+        size_t num = k % (NUM + 1);
+
+        stm32crc_calc_multi(bufs, lens, crcs, num);
+        for (int i=0; i<num; i++) {
+            assert(crcs[i] == stm32crc_calc(bufs[i], lens[i]));
+        }
+    }
+
+    printf("passed\n");
+}
+
+static void stm32crc_multi_bench(void)
+{
+    enum { NUM = 64, SIZE = 256, REPS = 65536 };
+    static uint8_t pool[NUM][SIZE];
+    const uint8_t* bufs[NUM];
+    size_t lens[NUM];
+    uint32_t crcs[NUM];
+    clock_t start, end;
+    double secs;
+    double mb = (double)NUM * SIZE * REPS / (1024.0 * 1024.0);
+
+    for (int i=NUM; i--;) {
+        for (int j=SIZE; j--;) {
+            pool[i][j] = rand();
+        }
+        bufs[i] = pool[i];
+        lens[i] = SIZE;
+    }
+
+    printf("\nMicrobenchmarks for CRC32 of %d-byte packets (%.0f MB):\n\n", SIZE, mb);
+
+    start = clock();
+    for (int k=REPS; k--;) {
+        for (int i=NUM; i--;) {
+            crcs[i] = stm32crc_calc(bufs[i], lens[i]);
+        }
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tstm32crc_calc() loop:\t%.3f (%.1f MB/s)\n", secs, mb / (secs > 0.0 ? secs : 1e-9));
+
+    start = clock();
+    for (int k=REPS; k--;) {
+        stm32crc_calc_multi(bufs, lens, crcs, NUM);
+    }
+    end = clock();
+    secs = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tstm32crc_calc_multi():\t%.3f (%.1f MB/s)\n", secs, mb / (secs > 0.0 ? secs : 1e-9));
+
+    assert(crcs[0] == stm32crc_calc(bufs[0], lens[0]));
+    printf("\ndone\n");
+}
+
+//
+//  Throughput sweep, over buffer sizes and misalignments
+///
+
+static uint32_t crc_parallel(const uint8_t* buf, size_t len)
+{
+    return stm32crc_calc_parallel(buf, len, 0);
+}
+
+static const struct {
+    const char* name;
+    stm32crc_fn fn;
+} crc_kernels[] = {
+    {"next()",   crc_reference},
+    {"bytewise", stm32crc_calc_bytewise},
+    {"slice8",   stm32crc_calc_slice8},
+    {"slice16",  stm32crc_calc_slice16},
+    {"clmul",    stm32crc_calc_clmul},
+    {"calc()",   stm32crc_calc},
+    {"parallel", crc_parallel},
+};
+
+#define CRC_KERNELS (sizeof(crc_kernels) / sizeof(crc_kernels[0]))
+
+static inline double crc_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static inline uint64_t crc_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Runs 'fn' over 'len' bytes enough times to process about 'CRC_SWEEP_BYTES',
+ * and returns the throughput (GB/s), and the cycles per byte (TSC reference
+ * cycles, x86 only, otherwise zero).
+ */
+static double crc_measure(stm32crc_fn fn, const uint8_t* buf, size_t len, double* cpb)
+{
+    size_t reps = CRC_SWEEP_BYTES / len;
+    volatile uint32_t crc;
+    reps = reps > 0 ? reps : 1;
+
+    crc = fn(buf, len); // warm-up
+    double t0 = crc_now();
+    uint64_t c0 = crc_cycles();
+    for (size_t i=reps; i--;) {
+        crc = fn(buf, len);
+    }
+    uint64_t c1 = crc_cycles();
+    double t1 = crc_now();
+    (void)crc;
+
+    double bytes = (double)reps * (double)len;
+    *cpb = (double)(c1 - c0) / bytes;
+    return bytes / ((t1 - t0 > 0.0 ? t1 - t0 : 1e-9) * 1e9);
+}
+
+static void stm32crc_sweep_bench(void)
+{
+    uint8_t* buf = malloc(CRC_SWEEP_MAX + 8);
+    double gbps[CRC_KERNELS];
+    double cpbs[CRC_KERNELS];
+    uint32_t x = 0x12345678;
+
+    // Fast fill, since 'rand()' is too slow for 64 MB
+    for (size_t i=CRC_SWEEP_MAX + 8; i--;) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buf[i] = (uint8_t)x;
+    }
+
+    printf("\nCRC32 throughput sweep (GB/s | cycles/byte):\n\n");
+    printf("%10s", "bytes");
+    for (int k=0; k<CRC_KERNELS; k++) {
+        printf(" %15s", crc_kernels[k].name);
+    }
+    printf("\n");
+
+    for (size_t len=CRC_SWEEP_MIN; len<=CRC_SWEEP_MAX; len<<=2) {
+        for (int k=0; k<CRC_KERNELS; k++) {
+            gbps[k] = crc_measure(crc_kernels[k].fn, buf, len, &cpbs[k]);
+        }
+        printf("%10zu", len);
+        for (int k=0; k<CRC_KERNELS; k++) {
+            printf(" %6.2f | %6.2f", gbps[k], cpbs[k]);
+        }
+        printf("\n");
+    }
+
+    printf("\nCRC32 misalignment matrix, stm32crc_calc() (GB/s):\n\n");
+    printf("%10s", "bytes");
+    for (int off=0; off<8; off++) {
+        printf("  +%d   ", off);
+    }
+    printf("\n");
+
+    for (size_t len=CRC_SWEEP_MIN; len<=CRC_SWEEP_MAX; len<<=4) {
+        printf("%10zu", len);
+        for (int off=0; off<8; off++) {
+            double cpb;
+            printf(" %6.2f", crc_measure(stm32crc_calc, buf + off, len, &cpb));
+        }
+        printf("\n");
+    }
+
+    printf("\ndone\n");
+
+    free(buf);
+}
 
 void stm32crc_tb(void)
 {
@@ -22,4 +327,10 @@ void stm32crc_tb(void)
     assert(crc == 0xf1c14ad9L);
 
     printf("passed\n");
+
+    stm32crc_variants_correct();
+    stm32crc_combine_correct();
+    stm32crc_multi_correct();
+    stm32crc_sweep_bench();
+    stm32crc_multi_bench();
 }
@@ -0,0 +1,208 @@
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "strfmt.hpp"
+#include "strfmt_hpp_tb.h"
+
+
+#define FMT_BENCH_ITEMS 1000
+
+
+static uint64_t rand64(void)
+{
+    return (uint64_t)rand() << 62 ^ (uint64_t)rand() << 31 ^ (uint64_t)rand();
+}
+
+// Random values of every magnitude
+static uint64_t rand_mag64(void)
+{
+    return rand64() >> (rand() % 64);
+}
+
+
+//
+//  Sanity-checks
+///
+
+// The worst-case sizes are compile-time constants
+static_assert(strfmt::max_size<"*d {} {x}\n", uint32_t, uint32_t>() == 24);
+static_assert(strfmt::max_size<"{}{}{}{}", int16_t, uint16_t, int32_t, uint32_t>() == 6 + 5 + 11 + 10 + 1);
+static_assert(strfmt::max_size<"{}{}", int64_t, uint64_t>() == 20 + 20 + 1);
+static_assert(strfmt::max_size<"{}{}{s}{s}", float, double, float, double>() == 18 + 28 + 15 + 24 + 1);
+static_assert(strfmt::max_size<"{{{}}}", char>() == 4);
+static_assert(strfmt::max_size<"no args">() == 8);
+
+static void strfmt_hpp_sanity(void)
+{
+    char p[128], q[128];
+    char* end;
+
+    printf("\nStrFmt (compile-time) Sanity-Checks:\n");
+
+    // The 'gethex_tb' response
+    uint32_t len = 70112, crc = 0xaa699def;
+    char line[STRFMT_SIZE("*d {} {x}\n", len, crc)];
+    static_assert(sizeof(line) == 24);
+    end = STRFMT(line, "*d {} {x}\n", len, crc);
+    assert(strcmp(line, "*d 70112 AA699DEF\n") == 0 && end == &line[18]);
+
+    // Into a pointer (unchecked)
+    char* r = p;
+    end = STRFMT(r, "{}", (uint8_t)255);
+    assert(strcmp(p, "255") == 0 && end == &p[3]);
+
+    // Limits, and signed-ness from the type
+    STRFMT(p, "{} {} {} {}", (int16_t)INT16_MIN, (uint16_t)UINT16_MAX, (int32_t)INT32_MIN, (uint32_t)UINT32_MAX);
+    assert(strcmp(p, "-32768 65535 -2147483648 4294967295") == 0);
+    STRFMT(p, "{} {}", (int64_t)INT64_MIN, (uint64_t)UINT64_MAX);
+    assert(strcmp(p, "-9223372036854775808 18446744073709551615") == 0);
+
+    // Escaped braces, chars, and the empty format
+    end = STRFMT(p, "{{{}}}{}}}", 42, 'c');
+    assert(strcmp(p, "{42}c}") == 0 && end == &p[6]);
+    end = STRFMT(p, "");
+    assert(*p == '\0' && end == p);
+
+    // Floating-point
+    STRFMT(p, "{s} {s} {s}", 0.1f, 1e23, -0.0);
+    assert(strcmp(p, "0.1 1e+23 -0") == 0);
+    end = float_to_str(q, 1.5f) + q;
+    *end++ = ' ';
+    end += double_to_str(end, -2.25);
+    STRFMT(p, "{} {}", 1.5f, -2.25);
+    assert(strcmp(p, q) == 0);
+
+    printf("passed\n");
+}
+
+
+//
+//  Correctness
+///
+
+static void strfmt_hpp_correct(int reps)
+{
+    char p[128], q[128];
+    char *end, *ref;
+
+    printf("\nTesting STRFMT(..) for correctness (N = %d):\n", reps);
+
+    for (int i=reps; i--;) {
+        uint64_t x = rand_mag64(), y = rand_mag64();
+
+        end = STRFMT(p, "{} {} {} {} {} {}|{x}", (int16_t)x, (uint16_t)y, (int32_t)x, (uint32_t)y, (int64_t)x, y, (uint32_t)x);
+        int n = snprintf(q, sizeof(q), "%d %u %d %u %ld %lu|%08X", (int16_t)x, (uint16_t)y, (int32_t)x, (uint32_t)y, (int64_t)x, y, (uint32_t)x);
+        if (end - p != n || strcmp(p, q) != 0) {
+            printf("\t%s != %s\n", p, q);
+            assert(strcmp(p, q) == 0);
+        }
+
+        // Against the same converters, chained by hand
+        float f;
+        double d;
+        memcpy(&f, &x, sizeof(f));
+        memcpy(&d, &y, sizeof(d));
+
+        end = STRFMT(p, "[{}, {}, {s}, {s}]", f, d, f, d);
+        ref = q;
+        *ref++ = '[';
+        ref += float_to_str(ref, f);
+        *ref++ = ',';
+        *ref++ = ' ';
+        ref += double_to_str(ref, d);
+        *ref++ = ',';
+        *ref++ = ' ';
+        ref += float_to_shortest(ref, f);
+        *ref++ = ',';
+        *ref++ = ' ';
+        ref += double_to_shortest(ref, d);
+        *ref++ = ']';
+        *ref = '\0';
+        if (end != &p[ref - q] || strcmp(p, q) != 0) {
+            printf("\t%s != %s\n", p, q);
+            assert(strcmp(p, q) == 0);
+        }
+    }
+
+    printf("passed\n");
+}
+
+
+//
+//  Microbenchmarks
+///
+
+static void strfmt_hpp_bench(void)
+{
+    static uint32_t lens[FMT_BENCH_ITEMS], crcs[FMT_BENCH_ITEMS];
+    char line[STRFMT_SIZE("*d {} {x}\n", lens[0], crcs[0])];
+    clock_t start, end;
+    double base, ticks;
+    unsigned long bytes;
+
+    printf("\nMicrobenchmarks for STRFMT(..):\n\n");
+
+    for (int i=0; i<FMT_BENCH_ITEMS; i++) {
+        lens[i] = (uint32_t)rand_mag64();
+        crcs[i] = (uint32_t)rand64();
+    }
+
+    bytes = 0;
+    start = clock();
+    for (int k=10000; k--;) {
+        for (int j=FMT_BENCH_ITEMS; j--;) {
+            bytes += snprintf(line, sizeof(line), "*d %u %08X\n", lens[j], crcs[j]);
+        }
+    }
+    end = clock();
+    base = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tsnprintf():\t\t%.3f (bytes: %lu, 10M)\n", base, bytes);
+
+    bytes = 0;
+    start = clock();
+    for (int k=10000; k--;) {
+        for (int j=FMT_BENCH_ITEMS; j--;) {
+            char* p = line;
+            *p++ = '*';
+            *p++ = 'd';
+            *p++ = ' ';
+            p = printu32(p, lens[j]);
+            *p++ = ' ';
+            p = hex32(p, crcs[j]);
+            *p++ = '\n';
+            *p = '\0';
+            bytes += p - line;
+        }
+    }
+    end = clock();
+    ticks = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tprint*() chained:\t%.3f (bytes: %lu, 10M, x%.1f)\n", ticks, bytes, base / ticks);
+
+    bytes = 0;
+    start = clock();
+    for (int k=10000; k--;) {
+        for (int j=FMT_BENCH_ITEMS; j--;) {
+            bytes += STRFMT(line, "*d {} {x}\n", lens[j], crcs[j]) - line;
+        }
+    }
+    end = clock();
+    ticks = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tSTRFMT():\t\t%.3f (bytes: %lu, 10M, x%.1f)\n", ticks, bytes, base / ticks);
+
+    printf("\ndone\n");
+}
+
+
+//
+//  Testbench
+///
+
+void strfmt_hpp_tb(void)
+{
+    strfmt_hpp_sanity();
+    strfmt_hpp_correct(1000000);
+    strfmt_hpp_bench();
+}
@@ -0,0 +1,15 @@
+#ifndef __STRFMT_HPP_TB_H__
+#define __STRFMT_HPP_TB_H__
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+void strfmt_hpp_tb(void);
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif  /* __STRFMT_HPP_TB_H__ */
@@ -9,6 +9,10 @@
 
 #define MAX_FRAC_DIGITS  6
 
+// Define to test 'float_to_shortest(..)' with every 32-bit pattern, which takes
+// about an hour.
+// #define STRFMT_EXHAUSTIVE
+
 
 // The "reference" for the testbench.
 static int f32_to_str(char* buf, float x)
@@ -123,6 +127,165 @@ void strfmt_floating_bench()
     printf("\ndone\n\n");
 }
 
+static uint64_t rand_bits64()
+{
+    return (uint64_t)rand() << 62 ^ (uint64_t)rand() << 31 ^ (uint64_t)rand();
+}
+
+// Random, finite, floats and doubles, with uniformly-distributed bit-patterns
+static float rand_float_bits()
+{
+    float x;
+    do {
+        uint32_t bits = (uint32_t)rand_bits64();
+        memcpy(&x, &bits, sizeof(x));
+    } while (x - x != 0.0f);
+    return x;
+}
+
+static double rand_double_bits()
+{
+    double x;
+    do {
+        uint64_t bits = rand_bits64();
+        memcpy(&x, &bits, sizeof(x));
+    } while (x - x != 0.0);
+    return x;
+}
+
+void strfmt_shortest_bench()
+{
+    clock_t start, end;
+    double ticks;
+    uint64_t bytes = 0;
+    float frands[1000];
+    double drands[1000];
+    char buf[256];
+
+    for (int i=1000; i--;) {
+        frands[i] = rand_float_bits();
+        drands[i] = rand_double_bits();
+    }
+
+    printf("\nMicrobenchmarks for SHORTEST formatters:\n\n");
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=1000; i--;) {
+        for (int j=1000; j--;) {
+            int n = float_to_shortest(buf, frands[j]);
+            bytes += n;
+        }
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tfloat_to_shortest(): \t%.3f (bytes: %lu, 1M)\n", ticks, bytes);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=1000; i--;) {
+        for (int j=1000; j--;) {
+            int n = snprintf(buf, sizeof(buf), "%.9g", frands[j]);
+            bytes += n;
+        }
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tsnprintf(\"%%.9g\"):   \t%.3f (bytes: %lu, 1M)\n", ticks, bytes);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=1000; i--;) {
+        for (int j=1000; j--;) {
+            int n = double_to_shortest(buf, drands[j]);
+            bytes += n;
+        }
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tdouble_to_shortest():\t%.3f (bytes: %lu, 1M)\n", ticks, bytes);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=1000; i--;) {
+        for (int j=1000; j--;) {
+            int n = snprintf(buf, sizeof(buf), "%.17g", drands[j]);
+            bytes += n;
+        }
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tsnprintf(\"%%.17g\"):  \t%.3f (bytes: %lu, 1M)\n", ticks, bytes);
+
+    printf("\ndone\n\n");
+}
+
+void strfmt_array_bench()
+{
+    clock_t start, end;
+    double ticks, base;
+    uint64_t bytes = 0;
+    int32_t i32s[1000];
+    int16_t i16s[1000];
+    static char buf[FORMAT_I32_ARRAY_BYTES(1000)];
+
+    // Mixed magnitudes, and "sample-like" 16-bit values
+    for (int i=1000; i--;) {
+        i32s[i] = (int32_t)((uint32_t)rand() << 1 ^ (uint32_t)rand()) >> (rand() % 24);
+        i16s[i] = (int16_t)(rand() % 8192 - 4096);
+    }
+
+    printf("\nMicrobenchmarks for ARRAY formatters:\n\n");
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=10000; i--;) {
+        char* p = buf;
+        for (int j=0; j<1000; j++) {
+            p += sprinti32(p, i32s[j]);
+            *p++ = ',';
+        }
+        bytes += p - buf;
+    }
+    end = clock();
+    base = ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tsprinti32() loop:  \t%.3f (bytes: %lu, 10M)\n", ticks, bytes);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=10000; i--;) {
+        bytes += format_i32_array(buf, i32s, 1000, ',');
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tformat_i32_array():\t%.3f (bytes: %lu, 10M, x%.1f)\n", ticks, bytes, base / ticks);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=10000; i--;) {
+        char* p = buf;
+        for (int j=0; j<1000; j++) {
+            p += sprinti16(p, i16s[j]);
+            *p++ = ',';
+        }
+        bytes += p - buf;
+    }
+    end = clock();
+    base = ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tsprinti16() loop:  \t%.3f (bytes: %lu, 10M)\n", ticks, bytes);
+
+    bytes = 0; ticks = 0.0;
+    start = clock();
+    for (int i=10000; i--;) {
+        bytes += format_i16_array(buf, i16s, 1000, ',');
+    }
+    end = clock();
+    ticks += ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tformat_i16_array():\t%.3f (bytes: %lu, 10M, x%.1f)\n", ticks, bytes, base / ticks);
+
+    printf("\ndone\n\n");
+}
+
 void strfmt_integral_bench()
 {
     volatile clock_t start, end;
@@ -435,6 +598,100 @@ void strfmt_integral_correct(const int reps)
         }
     }
 
+    // Digit-count edge-cases, around each power of ten
+    for (uint64_t e=1, k=0; k<20; k++, e*=10) {
+        for (uint64_t y=e-1; y<=e+1; y++) {
+            sprintf(p, "%lu", y);
+            assert(printu64(q, y) - q == (long)strlen(p) && strcmp(p, q) == 0);
+            if (y <= UINT32_MAX) {
+                sprintf(p, "%u", (uint32_t)y);
+                assert(printu32(q, y) - q == (long)strlen(p) && strcmp(p, q) == 0);
+            }
+        }
+    }
+    assert(strcmp((printu64(q, UINT64_MAX), q), "18446744073709551615") == 0);
+    assert(strcmp((printu32(q, UINT32_MAX), q), "4294967295") == 0);
+    assert(strcmp((printi64(q, INT64_MIN + 1), q), "-9223372036854775807") == 0);
+    assert(strcmp((printi64(q, INT64_MIN), q), "-9223372036854775808") == 0);
+    assert(strcmp((printi32(q, INT32_MIN), q), "-2147483648") == 0);
+    assert(sprinti32(q, INT32_MIN) == 11 && strcmp(q, "-2147483648") == 0);
+    assert(strcmp((printi16(q, INT16_MIN), q), "-32768") == 0);
+    assert(strcmp((printi64(q, INT64_MAX), q), "9223372036854775807") == 0);
+    assert(strcmp((printi32(q, INT32_MAX), q), "2147483647") == 0);
+
+    printf("passed\n\n");
+}
+
+void strfmt_array_correct(int reps)
+{
+    int32_t i32s[37];
+    uint32_t u32s[37];
+    int16_t i16s[37];
+    uint16_t u16s[37];
+    char p[FORMAT_I32_ARRAY_BYTES(37)];
+    char q[FORMAT_I32_ARRAY_BYTES(37)];
+
+    printf("\nTesting ARRAY formatters for correctness (N = %d):\n", reps);
+
+    for (int i=reps; i--;) {
+        // Every length, up to a few blocks of four, and every magnitude
+        int n = i % 37;
+        for (int j=0; j<n; j++) {
+            uint32_t r = (uint32_t)rand() << 1 ^ (uint32_t)rand();
+            u32s[j] = r >> (rand() % 32);
+            i32s[j] = (rand() & 1) ? (int32_t)u32s[j] : (int32_t)(0u - u32s[j]);
+            i16s[j] = (int16_t)r;
+            u16s[j] = (uint16_t)(r >> 16);
+        }
+        if (n > 1 && i % 5 == 0) {
+            i32s[1] = INT32_MIN;
+            u32s[1] = UINT32_MAX;
+            i16s[1] = INT16_MIN;
+            u16s[1] = UINT16_MAX;
+        }
+
+        char* r = q;
+        *r = '\0';
+        for (int j=0; j<n; j++) {
+            r += sprintf(r, j ? ",%d" : "%d", i32s[j]);
+        }
+        size_t m = format_i32_array(p, i32s, n, ',');
+        if (m != strlen(q) || strcmp(p, q) != 0) {
+            printf("i: %6d  =>  p: '%s', q: '%s'\n", i, p, q);
+            assert(0);
+        }
+
+        r = q;
+        for (int j=0; j<n; j++) {
+            r += sprintf(r, j ? ",%u" : "%u", u32s[j]);
+        }
+        m = format_u32_array(p, u32s, n, ',');
+        if (m != strlen(q) || strcmp(p, q) != 0) {
+            printf("i: %6d  =>  p: '%s', q: '%s'\n", i, p, q);
+            assert(0);
+        }
+
+        r = q;
+        for (int j=0; j<n; j++) {
+            r += sprintf(r, j ? " %d" : "%d", i16s[j]);
+        }
+        m = format_i16_array(p, i16s, n, ' ');
+        if (m != strlen(q) || strcmp(p, q) != 0) {
+            printf("i: %6d  =>  p: '%s', q: '%s'\n", i, p, q);
+            assert(0);
+        }
+
+        r = q;
+        for (int j=0; j<n; j++) {
+            r += sprintf(r, j ? " %u" : "%u", u16s[j]);
+        }
+        m = format_u16_array(p, u16s, n, ' ');
+        if (m != strlen(q) || strcmp(p, q) != 0) {
+            printf("i: %6d  =>  p: '%s', q: '%s'\n", i, p, q);
+            assert(0);
+        }
+    }
+
     printf("passed\n\n");
 }
 
@@ -511,10 +768,177 @@ void strfmt_floating_correct(int reps)
     printf("passed\n\n");
 }
 
+/**
+ * Significant digits (without leading and trailing zeros) of the decimal 's',
+ * and the exponent of the last digit.
+ */
+static int sig_digits(const char* s, char* d, int* e)
+{
+    int n = 0, dot = -1, exp = 0;
+
+    for (; *s && *s != 'e'; s++) {
+        if (*s == '.') {
+            dot = n;
+        } else if (*s >= '0' && *s <= '9' && (n != 0 || *s != '0')) {
+            d[n++] = *s;
+        } else if (*s == '0' && dot >= 0) {
+            exp--;
+        }
+    }
+    if (*s == 'e') {
+        exp += atoi(s + 1);
+    }
+    exp += dot >= 0 ? dot - n : 0;
+    while (n > 1 && d[n-1] == '0') {
+        n--;
+        exp++;
+    }
+    if (n == 0) {
+        d[n++] = '0';
+        exp = 0;
+    }
+    d[n] = '\0';
+    *e = exp;
+    return n;
+}
+
+/**
+ * Checks that 's' reads back as 'x', that one fewer digit (rounded by libc)
+ * does not, and that it has the same digits as libc, rounded to its length.
+ */
+static int check_shortest(const char* s, double x, int is_float)
+{
+    char r[64], rd[32], sd[32];
+    int re, se;
+
+    double y = is_float ? (double)strtof(s, NULL) : strtod(s, NULL);
+    if (memcmp(&x, &y, sizeof(x)) != 0) {
+        return 0;
+    }
+
+    int n = sig_digits(s, sd, &se);
+    if (n > 1) {
+        snprintf(r, sizeof(r), "%.*e", n - 2, x);
+        y = is_float ? (double)strtof(r, NULL) : strtod(r, NULL);
+        if (y == x) {
+            return 0;
+        }
+    }
+
+    snprintf(r, sizeof(r), "%.*e", n - 1, x);
+    y = is_float ? (double)strtof(r, NULL) : strtod(r, NULL);
+    if (y == x) {
+        sig_digits(r, rd, &re);
+        return strcmp(rd, sd) == 0 && re == se;
+    }
+    return 1;
+}
+
+#ifdef STRFMT_EXHAUSTIVE
+static void strfmt_shortest_exhaustive()
+{
+    char p[64];
+    uint32_t bits = 0;
+
+    printf("\nTesting float_to_shortest() with all 2^32 floats:\n");
+    do {
+        float x;
+        memcpy(&x, &bits, sizeof(x));
+        if (x - x == 0.0f) {
+            float_to_shortest(p, x);
+            if (!check_shortest(p, x, 1)) {
+                printf("bits: 0x%08x  =>  x = %.9g, p: '%s'\n", bits, x, p);
+                assert(0);
+            }
+        }
+        if ((bits & 0x0fffffff) == 0) {
+            printf("\t0x%08x\n", bits);
+            fflush(stdout);
+        }
+    } while (++bits != 0);
+
+    printf("passed\n\n");
+}
+#endif  /* STRFMT_EXHAUSTIVE */
+
+void strfmt_shortest_correct(int reps)
+{
+    char p[64];
+
+    printf("\nTesting SHORTEST formatters for correctness (N = %d):\n", reps);
+
+    // Special values, and the extremes of each format
+    static const struct {
+        double x;
+        const char* f;
+        const char* d;
+    } cases[] = {
+        { 0.0, "0", "0" },
+        { -0.0, "-0", "-0" },
+        { 1.0 / 0.0, "+Inf", "+Inf" },
+        { -1.0 / 0.0, "-Inf", "-Inf" },
+        { 0.0 / 0.0, "NaN", "NaN" },
+        { 1.0, "1", "1" },
+        { 0.1, "0.1", "0.1" },
+        { -1.5, "-1.5", "-1.5" },
+        { 100.0, "100", "100" },
+        { 0.0001, "0.0001", "0.0001" },
+        { 0.00001, "1e-05", "1e-05" },
+        { 1e9, "1e+09", "1000000000" },
+        { 1e17, "1e+17", "1e+17" },
+        { 1e23, "1e+23", "1e+23" },
+        { 5e-324, "0", "5e-324" },
+        { 1.7976931348623157e308, "+Inf", "1.7976931348623157e+308" },
+        { 3.4028234663852886e38, "3.4028235e+38", "3.4028234663852886e+38" },
+        { 1.401298464324817e-45, "1e-45", "1.401298464324817e-45" },
+        { 1.1754943508222875e-38, "1.1754944e-38", "1.1754943508222875e-38" }
+    };
+
+    for (int i=0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++) {
+        int n = float_to_shortest(p, (float)cases[i].x);
+        if (n != (int)strlen(p) || strcmp(p, cases[i].f) != 0) {
+            printf("x = %.17g, p: '%s', expected: '%s'\n", cases[i].x, p, cases[i].f);
+            assert(0);
+        }
+        n = double_to_shortest(p, cases[i].x);
+        if (n != (int)strlen(p) || strcmp(p, cases[i].d) != 0) {
+            printf("x = %.17g, p: '%s', expected: '%s'\n", cases[i].x, p, cases[i].d);
+            assert(0);
+        }
+    }
+
+    // Random bit-patterns, which are mostly very large, or very small, and
+    // values from 'rand_float()', which are not
+    for (int i=reps; i--;) {
+        float x = (i & 1) ? rand_float_bits() : rand_float();
+        double y = (i & 1) ? rand_double_bits() : (double)x / 3.0;
+
+        float_to_shortest(p, x);
+        if (!check_shortest(p, x, 1)) {
+            printf("i: %6d  =>  x = %.9g, p: '%s'\n", i, x, p);
+            dump_float_bits(x);
+            assert(0);
+        }
+        double_to_shortest(p, y);
+        if (!check_shortest(p, y, 0)) {
+            printf("i: %6d  =>  y = %.17g, p: '%s'\n", i, y, p);
+            assert(0);
+        }
+    }
+
+    printf("passed\n\n");
+
+#ifdef STRFMT_EXHAUSTIVE
+    strfmt_shortest_exhaustive();
+#endif
+}
+
 void strfmt_correct(const int reps)
 {
     strfmt_integral_correct(reps);
+    strfmt_array_correct(reps / 10);
     strfmt_floating_correct(reps);
+    strfmt_shortest_correct(reps / 10);
 }
 
 
@@ -528,7 +952,9 @@ void strfmt_tb()
     srand((unsigned) time(&t));
 
     strfmt_integral_bench();
+    strfmt_array_bench();
     strfmt_floating_bench();
+    strfmt_shortest_bench();
 
     strfmt_correct(10000000);
 }
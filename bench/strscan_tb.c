@@ -0,0 +1,387 @@
+#include <assert.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "strfmt.h"
+#include "strscan.h"
+
+
+#define SCAN_BENCH_ITEMS 1000
+#define SCAN_BENCH_REPS  10000
+
+
+static uint64_t rand64(void)
+{
+    return (uint64_t)rand() << 62 ^ (uint64_t)rand() << 31 ^ (uint64_t)rand();
+}
+
+// Random values of every magnitude
+static uint64_t rand_mag64(void)
+{
+    return rand64() >> (rand() % 64);
+}
+
+
+//
+//  Sanity-checks
+///
+
+static void strscan_sanity(void)
+{
+    uint16_t u16;
+    int16_t i16;
+    uint32_t u32;
+    int32_t i32;
+    uint64_t u64;
+    int64_t i64;
+    const char* p;
+
+    printf("\nStrScan Sanity-Checks:\n");
+
+    // The 'gethex_tb' strings
+    const char done[] = "*d 70112 aa699def\n";
+    p = scanu32(&done[2], &u32);
+    assert(p == &done[8] && u32 == 70112);
+    p = scanhex32(p, &u32);
+    assert(p == &done[17] && u32 == 0xaa699def);
+    assert(scanhex32("  0xfab", &u32) != NULL && u32 == 0xfab);
+    assert(scanhex32("\t0baf\n", &u32) != NULL && u32 == 0xbaf);
+    assert(scanhex32("0x", &u32) != NULL && u32 == 0);
+
+    // Limits
+    assert(scani16("-32768", &i16) != NULL && i16 == INT16_MIN);
+    assert(scani16("32767", &i16) != NULL && i16 == INT16_MAX);
+    assert(scani16("32768", &i16) == NULL);
+    assert(scanu16("65535", &u16) != NULL && u16 == UINT16_MAX);
+    assert(scanu16("65536", &u16) == NULL);
+    assert(scani32("-2147483648", &i32) != NULL && i32 == INT32_MIN);
+    assert(scani32("2147483648", &i32) == NULL);
+    assert(scanu32("4294967295", &u32) != NULL && u32 == UINT32_MAX);
+    assert(scanu32("4294967296", &u32) == NULL);
+    assert(scani64("-9223372036854775808", &i64) != NULL && i64 == INT64_MIN);
+    assert(scani64("9223372036854775808", &i64) == NULL);
+    assert(scanu64("18446744073709551615", &u64) != NULL && u64 == UINT64_MAX);
+    assert(scanu64("18446744073709551616", &u64) == NULL);
+    assert(scanu64("99999999999999999999", &u64) == NULL);
+    assert(scanhex64("FFFFFFFFffffffff", &u64) != NULL && u64 == UINT64_MAX);
+    assert(scanhex64("1FFFFFFFFFFFFFFFF", &u64) == NULL);
+    assert(scanhex32("100000000", &u32) == NULL);
+    assert(scanhex32("0000000000000000DEADBEEF", &u32) != NULL && u32 == 0xdeadbeef);
+
+    // Syntax
+    assert(scanu32("", &u32) == NULL);
+    assert(scanu32("-1", &u32) == NULL);
+    assert(scani32("-", &i32) == NULL);
+    assert(scani32("+", &i32) == NULL);
+    assert(scanhex32("g", &u32) == NULL);
+    assert(scani32("+42", &i32) != NULL && i32 == 42);
+    assert(scanu64("000000000000000000000000042", &u64) != NULL && u64 == 42);
+    p = "-0012345678901234x";
+    assert(scani64(p, &i64) == p + 17 && i64 == -12345678901234ll);
+
+    float f;
+    double d;
+    assert(scanfloat("NaN", &f) != NULL && f != f);
+    assert(scanfloat("+Inf", &f) != NULL && f == 1.0f / 0.0f);
+    assert(scandouble("-Inf", &d) != NULL && d == -1.0 / 0.0);
+    assert(scandouble("-0", &d) != NULL && d == 0.0 && 1.0 / d < 0.0);
+    assert(scandouble(".5", &d) != NULL && d == 0.5);
+    assert(scandouble("5.", &d) != NULL && d == 5.0);
+    assert(scandouble(".", &d) == NULL);
+    assert(scandouble("e5", &d) == NULL);
+    p = "1.5e";
+    assert(scandouble(p, &d) == p + 3 && d == 1.5);
+    assert(scandouble("4.9406564584124654e-324", &d) != NULL && d == 4.9406564584124654e-324);
+    assert(scandouble("1.7976931348623157e+308", &d) != NULL && d == 1.7976931348623157e308);
+    assert(scanfloat("3.4028235e+38", &f) != NULL && f == 3.4028235e38f);
+    assert(scanfloat("1e-45", &f) != NULL && f == 1e-45f);
+
+    printf("passed\n");
+}
+
+/**
+ * Numbers that end at the very end of a page, which is followed by a page that
+ * can't be read, to check that the 8-byte loads don't cross into it.
+ */
+static void strscan_page_tb(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    char* mem = mmap(NULL, page * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert(mem != MAP_FAILED);
+    assert(mprotect(mem + page, page, PROT_NONE) == 0);
+
+    printf("\nStrScan page-boundary checks:\n");
+
+    char* end = mem + page;
+    for (int len=1; len <= 20; len++) {
+        uint64_t u64;
+        uint64_t want = 0;
+        char* s = end - len - 1;
+        for (int i=0; i<len; i++) {
+            s[i] = '1' + i % 9;
+            want = want * 10 + (uint64_t)(1 + i % 9);
+        }
+        s[len] = '\0';
+
+        for (int i=0; i<len; i++) {
+            if (len < 20) {
+                assert(scanu64(s, &u64) == s + len && u64 == want);
+            }
+            double d;
+            assert(scandouble(s + i, &d) == s + len);
+            uint64_t h;
+            assert(scanhex64(s + i, &h) == (len - i <= 16 ? s + len : NULL));
+        }
+    }
+
+    munmap(mem, page * 2);
+    printf("passed\n");
+}
+
+/**
+ * Hard cases (that need the libc slow-path) in a locale with a ',' decimal
+ * point, which must still parse the whole number, as in the "C" locale.
+ */
+static void strscan_locale_tb(void)
+{
+    static const char* const names[] = {
+        "de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"
+    };
+    const char dstr[] = "3.14159265358979e-300";
+    const char fstr[] = "1.00000005960464477539";
+    double d, dwant = strtod(dstr, NULL);
+    float f, fwant = strtof(fstr, NULL);
+
+    printf("\nStrScan ',' locale checks:\n");
+
+    const char* name = NULL;
+    for (size_t i=0; i < sizeof(names) / sizeof(names[0]) && name == NULL; i++) {
+        if (setlocale(LC_NUMERIC, names[i]) != NULL) {
+            name = names[i];
+        }
+    }
+    if (name == NULL) {
+        printf("skipped (no ',' locale installed)\n");
+        return;
+    }
+
+    // 'strtod(..)' itself now stops at the '.'
+    char* q;
+    strtod(dstr, &q);
+    assert(q == &dstr[1]);
+
+    assert(scandouble(dstr, &d) == &dstr[sizeof(dstr) - 1] && d == dwant);
+    assert(scanfloat(fstr, &f) == &fstr[sizeof(fstr) - 1] && f == fwant);
+    assert(scandouble("-2.5e-320", &d) != NULL && d == -2.5e-320);
+
+    setlocale(LC_NUMERIC, "C");
+    printf("passed (%s)\n", name);
+}
+
+
+//
+//  Correctness
+///
+
+static void strscan_correct(int reps)
+{
+    char buf[64];
+    const char* p;
+
+    printf("\nTesting SCAN parsers for correctness (N = %d):\n", reps);
+
+    for (int i=reps; i--;) {
+        uint64_t r = rand_mag64();
+
+        // Integers, from the 'strfmt' formatters
+        int32_t i32 = (int32_t)r, j32;
+        char* e = printi32(buf, i32);
+        p = scani32(buf, &j32);
+        assert(p == e && i32 == j32);
+
+        uint32_t u32 = (uint32_t)r, v32;
+        e = printu32(buf, u32);
+        assert(scanu32(buf, &v32) == e && u32 == v32);
+
+        int16_t i16 = (int16_t)r, j16;
+        e = printi16(buf, i16);
+        assert(scani16(buf, &j16) == e && i16 == j16);
+
+        int64_t i64 = (i & 1) ? (int64_t)r : -(int64_t)r, j64;
+        e = printi64(buf, i64);
+        assert(scani64(buf, &j64) == e && i64 == j64);
+
+        e = hex32(buf, u32);
+        assert(scanhex32(buf, &v32) == e && u32 == v32);
+
+        uint64_t u64;
+        int n = sprintf(buf, (i & 1) ? "0x%lx" : "%lX", r);
+        assert(scanhex64(buf, &u64) == buf + n && u64 == r);
+
+        // Floats, which read back as for 'strtof(..)', and then format to the
+        // same string
+        float x;
+        do {
+            uint32_t bits = (uint32_t)rand64();
+            memcpy(&x, &bits, sizeof(x));
+        } while (x - x != 0.0f || x > 2e9f || x < -2e9f);
+
+        float y, z;
+        char again[64];
+        n = float_to_str(buf, x);
+        p = scanfloat(buf, &y);
+        z = strtof(buf, NULL);
+        assert(p == buf + n && memcmp(&y, &z, sizeof(y)) == 0);
+        float_to_str(again, y);
+
+        // Except that tiny negatives print as "-0", but -0.0 prints as "0"
+        assert(strcmp(buf, again) == 0 || y == 0.0f);
+
+        // The shortest formats read back exactly
+        n = float_to_shortest(buf, x);
+        assert(scanfloat(buf, &y) == buf + n && memcmp(&x, &y, sizeof(x)) == 0);
+
+        double dx, dy, dz;
+        do {
+            r = rand64();
+            memcpy(&dx, &r, sizeof(dx));
+        } while (dx - dx != 0.0);
+        n = double_to_shortest(buf, dx);
+        assert(scandouble(buf, &dy) == buf + n && memcmp(&dx, &dy, sizeof(dx)) == 0);
+
+        // Decimals with (many) more digits than a double holds, and that
+        // need the fall-back
+        n = sprintf(buf, "%.*f", rand() % 30, (double)(int32_t)rand64() / (double)(rand() + 1));
+        assert(scandouble(buf, &dy) == buf + n);
+        dz = strtod(buf, NULL);
+        assert(memcmp(&dy, &dz, sizeof(dy)) == 0);
+        assert(scanfloat(buf, &y) == buf + n);
+        z = strtof(buf, NULL);
+        assert(memcmp(&y, &z, sizeof(y)) == 0);
+    }
+
+    printf("passed\n");
+}
+
+
+//
+//  Performance
+///
+
+static void strscan_bench(void)
+{
+    static char strs[SCAN_BENCH_ITEMS][32];
+    clock_t start, end;
+    double ticks, base;
+    uint64_t sum;
+
+    printf("\nMicrobenchmarks for SCAN parsers:\n\n");
+
+    // Decimal 'int32_t'
+    for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+        printi32(strs[i], (int32_t)rand_mag64());
+    }
+
+    sum = 0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            sum += strtol(strs[i], NULL, 10);
+        }
+    }
+    end = clock();
+    base = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tstrtol():    \t%.3f (sum: %lu, 10M)\n", base, sum);
+
+    sum = 0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            int32_t x;
+            scani32(strs[i], &x);
+            sum += x;
+        }
+    }
+    end = clock();
+    ticks = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tscani32():   \t%.3f (sum: %lu, 10M, x%.1f)\n", ticks, sum, base / ticks);
+
+    // Hex, as from 'hex32(..)'
+    for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+        hex32(strs[i], (uint32_t)rand64());
+    }
+
+    sum = 0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            sum += strtoul(strs[i], NULL, 16);
+        }
+    }
+    end = clock();
+    base = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tstrtoul(16): \t%.3f (sum: %lu, 10M)\n", base, sum);
+
+    sum = 0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            uint32_t x;
+            scanhex32(strs[i], &x);
+            sum += x;
+        }
+    }
+    end = clock();
+    ticks = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tscanhex32(): \t%.3f (sum: %lu, 10M, x%.1f)\n", ticks, sum, base / ticks);
+
+    // Fixed-point, as from 'float_to_str(..)'
+    for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+        float_to_str(strs[i], (float)(int32_t)rand64() / (float)(rand() + 1));
+    }
+
+    double fsum = 0.0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            fsum += strtof(strs[i], NULL);
+        }
+    }
+    end = clock();
+    base = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tstrtof():    \t%.3f (sum: %g, 10M)\n", base, fsum);
+
+    fsum = 0.0;
+    start = clock();
+    for (int k=SCAN_BENCH_REPS; k--;) {
+        for (int i=0; i<SCAN_BENCH_ITEMS; i++) {
+            float x;
+            scanfloat(strs[i], &x);
+            fsum += x;
+        }
+    }
+    end = clock();
+    ticks = ((double)(end - start)) / CLOCKS_PER_SEC;
+    printf("\tscanfloat(): \t%.3f (sum: %g, 10M, x%.1f)\n", ticks, fsum, base / ticks);
+
+    printf("\ndone\n");
+}
+
+
+//
+//  Top-Level
+///
+
+void strscan_tb(void)
+{
+    strscan_sanity();
+    strscan_page_tb();
+    strscan_locale_tb();
+    strscan_correct(1000000);
+    strscan_bench();
+}
@@ -0,0 +1,6 @@
+#ifndef __STRSCAN_TB_H__
+#define __STRSCAN_TB_H__
+
+void strscan_tb(void);
+
+#endif  /* __STRSCAN_TB_H__ */
@@ -0,0 +1,211 @@
+#include "crc.h"
+
+
+#if CRC_ENGINE_SLICES != 1 && CRC_ENGINE_SLICES != 4 && CRC_ENGINE_SLICES != 8
+#error "CRC_ENGINE_SLICES must be one of 1, 4, or 8"
+#endif
+
+
+// -- Common configurations -- //
+
+// Check value (CRC of "123456789"): 0x29B1
+const crc_params_t crc16_ccitt_false = {16, 0, 0, 0x1021, 0xFFFF, 0x0000};
+
+// Check value: 0x2189
+const crc_params_t crc16_kermit = {16, 1, 1, 0x1021, 0x0000, 0x0000};
+
+// Check value: 0xCBF43926 (Ethernet, zlib, PNG, ...)
+const crc_params_t crc32_iso_hdlc = {32, 1, 1, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF};
+
+// Check value: 0xE3069283 (iSCSI, SCTP, ext4, ...)
+const crc_params_t crc32_castagnoli = {32, 1, 1, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF};
+
+// Check value: 0x0376E6E7 (STM32 CRC peripheral default)
+const crc_params_t crc32_mpeg2 = {32, 0, 0, 0x04C11DB7, 0xFFFFFFFF, 0x00000000};
+
+
+// -- Helper-functions -- //
+
+static uint32_t reflect(uint32_t x, int width)
+{
+    uint32_t y = 0;
+    for (int i = width; i--;) {
+        y = (y << 1) | (x & 1);
+        x >>= 1;
+    }
+    return y;
+}
+
+static inline uint32_t load32le(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint32_t load32be(const uint8_t* p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[3];
+}
+
+
+// -- Slicing engines -- //
+
+/**
+ * LSB-first (reflected) update, where the register holds the (reflected) CRC
+ * in its lower 'width' bits.
+ */
+static uint32_t crc_update_lsb(const uint32_t tab[][256], uint32_t crc, const uint8_t* p, size_t n)
+{
+#if CRC_ENGINE_SLICES == 8
+    while (n >= 8) {
+        uint32_t one = crc ^ load32le(p);
+        crc = tab[7][one & 0xff] ^ tab[6][(one >> 8) & 0xff] ^
+            tab[5][(one >> 16) & 0xff] ^ tab[4][one >> 24] ^
+            tab[3][p[4]] ^ tab[2][p[5]] ^ tab[1][p[6]] ^ tab[0][p[7]];
+        p += 8;
+        n -= 8;
+    }
+#elif CRC_ENGINE_SLICES == 4
+    while (n >= 4) {
+        uint32_t one = crc ^ load32le(p);
+        crc = tab[3][one & 0xff] ^ tab[2][(one >> 8) & 0xff] ^
+            tab[1][(one >> 16) & 0xff] ^ tab[0][one >> 24];
+        p += 4;
+        n -= 4;
+    }
+#endif
+
+    while (n--) {
+        crc = (crc >> 8) ^ tab[0][(crc ^ *p++) & 0xff];
+    }
+    return crc;
+}
+
+/**
+ * MSB-first update, where the register holds the CRC in its upper 'width' bits.
+ */
+static uint32_t crc_update_msb(const uint32_t tab[][256], uint32_t crc, const uint8_t* p, size_t n)
+{
+#if CRC_ENGINE_SLICES == 8
+    while (n >= 8) {
+        uint32_t one = crc ^ load32be(p);
+        crc = tab[7][one >> 24] ^ tab[6][(one >> 16) & 0xff] ^
+            tab[5][(one >> 8) & 0xff] ^ tab[4][one & 0xff] ^
+            tab[3][p[4]] ^ tab[2][p[5]] ^ tab[1][p[6]] ^ tab[0][p[7]];
+        p += 8;
+        n -= 8;
+    }
+#elif CRC_ENGINE_SLICES == 4
+    while (n >= 4) {
+        uint32_t one = crc ^ load32be(p);
+        crc = tab[3][one >> 24] ^ tab[2][(one >> 16) & 0xff] ^
+            tab[1][(one >> 8) & 0xff] ^ tab[0][one & 0xff];
+        p += 4;
+        n -= 4;
+    }
+#endif
+
+    while (n--) {
+        crc = (crc << 8) ^ tab[0][(crc >> 24) ^ *p++];
+    }
+    return crc;
+}
+
+
+// -- Exported functions -- //
+
+/**
+ * Pre-generates the tables for the given CRC parameters, and returns 1, or 0
+ * (leaving the engine unchanged) if the width isn't from 1 to 32 bits.
+ */
+int crc_engine_init(crc_engine_t* eng, const crc_params_t* par)
+{
+    const int w = par->width;
+
+    if (w < 1 || w > 32) {
+        return 0;
+    }
+
+    eng->par = *par;
+    eng->shift = 32 - w;
+
+    if (par->refin) {
+        uint32_t poly = reflect(par->poly, w);
+        eng->init = reflect(par->init, w);
+
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int j = 8; j--;) {
+                crc = (crc >> 1) ^ ((crc & 1) * poly);
+            }
+            eng->tab[0][i] = crc;
+        }
+        for (int k = 1; k < CRC_ENGINE_SLICES; k++) {
+            for (int i = 0; i < 256; i++) {
+                uint32_t crc = eng->tab[k-1][i];
+                eng->tab[k][i] = (crc >> 8) ^ eng->tab[0][crc & 0xff];
+            }
+        }
+    } else {
+        uint32_t poly = par->poly << eng->shift;
+        eng->init = par->init << eng->shift;
+
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i << 24;
+            for (int j = 8; j--;) {
+                crc = (crc << 1) ^ ((crc >> 31) * poly);
+            }
+            eng->tab[0][i] = crc;
+        }
+        for (int k = 1; k < CRC_ENGINE_SLICES; k++) {
+            for (int i = 0; i < 256; i++) {
+                uint32_t crc = eng->tab[k-1][i];
+                eng->tab[k][i] = (crc << 8) ^ eng->tab[0][crc >> 24];
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * Returns the initial register value, for streaming calculations.
+ */
+uint32_t crc_start(const crc_engine_t* eng)
+{
+    return eng->init;
+}
+
+/**
+ * Updates the register value 'crc' with the next 'len' bytes.
+ */
+uint32_t crc_update(const crc_engine_t* eng, uint32_t crc, const uint8_t* buf, size_t len)
+{
+    if (eng->par.refin) {
+        return crc_update_lsb(eng->tab, crc, buf, len);
+    }
+    return crc_update_msb(eng->tab, crc, buf, len);
+}
+
+/**
+ * Converts a register value into the CRC value, by applying any output
+ * reflection, and then 'xorout'.
+ */
+uint32_t crc_finish(const crc_engine_t* eng, uint32_t crc)
+{
+    const int w = eng->par.width;
+
+    if (!eng->par.refin) {
+        crc >>= eng->shift;
+    }
+    if (eng->par.refin != eng->par.refout) {
+        crc = reflect(crc, w);
+    }
+    return (crc ^ eng->par.xorout) & (0xFFFFFFFFu >> eng->shift);
+}
+
+/**
+ * Calculates the CRC of a byte string, in one pass.
+ */
+uint32_t crc_calc(const crc_engine_t* eng, const uint8_t* buf, size_t len)
+{
+    return crc_finish(eng, crc_update(eng, eng->init, buf, len));
+}
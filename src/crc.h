@@ -0,0 +1,88 @@
+#ifndef __CRC_H__
+#define __CRC_H__
+
+/**
+ * Parameterised CRC engine, for CRCs of 1 to 32 bits, with the parameters of
+ * the "Rocksoft" model (as used by the CRC catalogue):
+ *  - width, polynomial (normal form, without the x^width term), and initial
+ *    value;
+ *  - whether the input bytes and/or the output value are reflected;
+ *  - the value that is XOR'd into the output;
+ *
+ * Note(s):
+ *  - 'crc_engine_init(..)' pre-generates slicing tables for a configuration,
+ *    after which the engine is constant, and may be shared between threads,
+ *    and it rejects (returning 0) widths outside 1 to 32 bits;
+ *  - reflected CRCs use an LSB-first register, and the others use an MSB-first
+ *    register, left-aligned to 32 bits, so that every width uses the same
+ *    slicing loops;
+ *  - for CRC-32/MPEG-2 (the STM32 default), 'stm32crc_calc(..)' remains the
+ *    fully-specialised (and faster) version;
+ *  - engine size is 'CRC_ENGINE_SLICES' kB (8 kB, by default);
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+// -- Build-time configuration -- //
+
+// Number of 256-entry slicing tables, per engine, which must be 1, 4, or 8.
+#ifndef CRC_ENGINE_SLICES
+#define CRC_ENGINE_SLICES 8
+#endif
+
+
+// -- Data types -- //
+
+typedef struct {
+    uint8_t width;
+    uint8_t refin;
+    uint8_t refout;
+    uint32_t poly;
+    uint32_t init;
+    uint32_t xorout;
+} crc_params_t;
+
+typedef struct {
+    crc_params_t par;
+    uint32_t init;
+    uint8_t shift;
+    uint32_t tab[CRC_ENGINE_SLICES][256];
+} crc_engine_t;
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Common configurations -- //
+
+extern const crc_params_t crc16_ccitt_false;
+extern const crc_params_t crc16_kermit;
+extern const crc_params_t crc32_iso_hdlc;
+extern const crc_params_t crc32_castagnoli;
+extern const crc_params_t crc32_mpeg2;
+
+
+// -- Exported functions -- //
+
+int crc_engine_init(crc_engine_t* eng, const crc_params_t* par);
+
+uint32_t crc_start(const crc_engine_t* eng);
+uint32_t crc_update(const crc_engine_t* eng, uint32_t crc, const uint8_t* buf, size_t len);
+uint32_t crc_finish(const crc_engine_t* eng, uint32_t crc);
+
+uint32_t crc_calc(const crc_engine_t* eng, const uint8_t* buf, size_t len);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __CRC_H__ */
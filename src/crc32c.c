@@ -0,0 +1,173 @@
+#include "crc32c.h"
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(CRC32C_NO_SSE42)
+#include <immintrin.h>
+#define CRC32C_HAVE_SSE42
+#endif
+
+// Constant tables, generated at build-time by 'crctab.c'
+#include "crc32c_tab.h"
+
+
+// -- Helper-functions -- //
+
+static inline uint32_t load32le(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+
+// -- Software engine -- //
+
+/**
+ * Slicing-by-8 update of the (raw, un-inverted) register.
+ */
+static uint32_t crc32c_sw(uint32_t crc, const uint8_t* p, size_t n)
+{
+    while (n >= 8) {
+        uint32_t one = crc ^ load32le(p);
+        crc = crc32c_tab[7][one & 0xff] ^ crc32c_tab[6][(one >> 8) & 0xff] ^
+            crc32c_tab[5][(one >> 16) & 0xff] ^ crc32c_tab[4][one >> 24] ^
+            crc32c_tab[3][p[4]] ^ crc32c_tab[2][p[5]] ^
+            crc32c_tab[1][p[6]] ^ crc32c_tab[0][p[7]];
+        p += 8;
+        n -= 8;
+    }
+
+    while (n--) {
+        crc = (crc >> 8) ^ crc32c_tab[0][(crc ^ *p++) & 0xff];
+    }
+    return crc;
+}
+
+
+// -- SSE4.2 engine -- //
+
+#ifdef CRC32C_HAVE_SSE42
+
+/**
+ * Applies the zero-bytes operator, for 'CRC32C_LONG' or 'CRC32C_SHORT' bytes, to
+ * the register 'crc'.
+ */
+static inline uint32_t crc32c_shift(const uint32_t zeros[4][256], uint32_t crc)
+{
+    return zeros[0][crc & 0xff] ^ zeros[1][(crc >> 8) & 0xff] ^
+        zeros[2][(crc >> 16) & 0xff] ^ zeros[3][crc >> 24];
+}
+
+static inline uint64_t load64(const uint8_t* p)
+{
+    uint64_t x;
+    memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+/**
+ * Hardware update of the (raw) register, using three independent streams, of
+ * 'blk' bytes each. The 'crc32' instruction has a latency of three cycles, but
+ * a throughput of one per cycle, so each stream hides the latency of the other
+ * two. Since the CRC is linear:
+ *   crc(A.B.C) = shift(shift(crc(A)) ^ crc(B)) ^ crc(C)
+ * where 'crc(B)' and 'crc(C)' start from zero.
+ */
+__attribute__((target("sse4.2")))
+static inline const uint8_t* crc32c_hw_3way(uint32_t* pcrc, const uint8_t* p, size_t* pn,
+                                            size_t blk, const uint32_t zeros[4][256])
+{
+    uint64_t crc0 = *pcrc;
+
+    while (*pn >= blk * 3) {
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        const uint8_t* end = p + blk;
+
+        do {
+            crc0 = _mm_crc32_u64(crc0, load64(p));
+            crc1 = _mm_crc32_u64(crc1, load64(p + blk));
+            crc2 = _mm_crc32_u64(crc2, load64(p + blk*2));
+            p += 8;
+        } while (p < end);
+
+        crc0 = crc32c_shift(zeros, (uint32_t)crc0) ^ (uint32_t)crc1;
+        crc0 = crc32c_shift(zeros, (uint32_t)crc0) ^ (uint32_t)crc2;
+        p += blk * 2;
+        *pn -= blk * 3;
+    }
+
+    *pcrc = (uint32_t)crc0;
+    return p;
+}
+
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hw(uint32_t crc, const uint8_t* p, size_t n)
+{
+    // Align to 8 bytes, so that the 64-bit loads don't straddle cache-lines
+    while (n != 0 && ((uintptr_t)p & 7) != 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+        n--;
+    }
+
+    p = crc32c_hw_3way(&crc, p, &n, CRC32C_LONG, crc32c_long);
+    p = crc32c_hw_3way(&crc, p, &n, CRC32C_SHORT, crc32c_short);
+
+    uint64_t crc0 = crc;
+    while (n >= 8) {
+        crc0 = _mm_crc32_u64(crc0, load64(p));
+        p += 8;
+        n -= 8;
+    }
+    crc = (uint32_t)crc0;
+
+    while (n--) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+
+#endif  /* CRC32C_HAVE_SSE42 */
+
+
+// -- Exported functions -- //
+
+/**
+ * Returns non-zero if the SSE4.2 engine is compiled in, and supported by this
+ * processor.
+ */
+int crc32c_has_hw(void)
+{
+#ifdef CRC32C_HAVE_SSE42
+    return __builtin_cpu_supports("sse4.2");
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Continue calculating a CRC-32C, from the previous (finished) CRC value.
+ */
+uint32_t crc32c_update(uint32_t crc, const uint8_t* buf, size_t len)
+{
+#ifdef CRC32C_HAVE_SSE42
+    if (crc32c_has_hw()) {
+        return ~crc32c_hw(~crc, buf, len);
+    }
+#endif
+    return ~crc32c_sw(~crc, buf, len);
+}
+
+/**
+ * Software-only version of 'crc32c_update(..)'.
+ */
+uint32_t crc32c_update_sw(uint32_t crc, const uint8_t* buf, size_t len)
+{
+    return ~crc32c_sw(~crc, buf, len);
+}
+
+/**
+ * Calculate the CRC-32C of a byte string, in one pass.
+ */
+uint32_t crc32c_calc(const uint8_t* buf, size_t len)
+{
+    return crc32c_update(0, buf, len);
+}
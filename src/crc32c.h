@@ -0,0 +1,44 @@
+#ifndef __CRC32C_H__
+#define __CRC32C_H__
+
+/**
+ * CRC-32C (Castagnoli) for host-side integrity checks of recorded streams, with
+ * an SSE4.2 engine (x86-64), and a slicing-by-8 software engine.
+ *
+ * Note(s):
+ *  - the SSE4.2 engine runs three interleaved streams, to hide the 3-cycle
+ *    latency of the 'crc32' instruction, and then merges them using constant
+ *    "shift" tables;
+ *  - the engine is selected at run-time, unless CRC32C_NO_SSE42 is defined;
+ *  - CRC values are "finished" values, so 'crc32c_update(0, buf, len)' is the
+ *    same as 'crc32c_calc(buf, len)', and the result of 'crc32c_update(..)'
+ *    can be passed straight back in, for the next chunk;
+ *  - same parameters as 'crc32_castagnoli' from "crc.h" (check: 0xE3069283);
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Exported functions -- //
+
+uint32_t crc32c_calc(const uint8_t* buf, size_t len);
+uint32_t crc32c_update(uint32_t crc, const uint8_t* buf, size_t len);
+uint32_t crc32c_update_sw(uint32_t crc, const uint8_t* buf, size_t len);
+int crc32c_has_hw(void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __CRC32C_H__ */
@@ -0,0 +1,750 @@
+/*
+ * File:    src/crc32c_tab.h
+ *
+ * Generated by src/crctab.c, do not edit.
+ *
+ * Description
+ * -----------
+ * Slicing tables for the (reflected) CRC-32C polynomial 0x82F63B78, and the
+ * tables that shift a register past 8192 and 256 zero bytes, which are used to
+ * combine the interleaved streams of the SSE4.2 engine.
+ */
+
+#define CRC32C_LONG  8192
+#define CRC32C_SHORT 256
+
+static const uint32_t crc32c_tab[8][256] =
+    {
+        {
+        0x00000000L, 0xF26B8303L, 0xE13B70F7L, 0x1350F3F4L, 0xC79A971FL, 0x35F1141CL,
+        0x26A1E7E8L, 0xD4CA64EBL, 0x8AD958CFL, 0x78B2DBCCL, 0x6BE22838L, 0x9989AB3BL,
+        0x4D43CFD0L, 0xBF284CD3L, 0xAC78BF27L, 0x5E133C24L, 0x105EC76FL, 0xE235446CL,
+        0xF165B798L, 0x030E349BL, 0xD7C45070L, 0x25AFD373L, 0x36FF2087L, 0xC494A384L,
+        0x9A879FA0L, 0x68EC1CA3L, 0x7BBCEF57L, 0x89D76C54L, 0x5D1D08BFL, 0xAF768BBCL,
+        0xBC267848L, 0x4E4DFB4BL, 0x20BD8EDEL, 0xD2D60DDDL, 0xC186FE29L, 0x33ED7D2AL,
+        0xE72719C1L, 0x154C9AC2L, 0x061C6936L, 0xF477EA35L, 0xAA64D611L, 0x580F5512L,
+        0x4B5FA6E6L, 0xB93425E5L, 0x6DFE410EL, 0x9F95C20DL, 0x8CC531F9L, 0x7EAEB2FAL,
+        0x30E349B1L, 0xC288CAB2L, 0xD1D83946L, 0x23B3BA45L, 0xF779DEAEL, 0x05125DADL,
+        0x1642AE59L, 0xE4292D5AL, 0xBA3A117EL, 0x4851927DL, 0x5B016189L, 0xA96AE28AL,
+        0x7DA08661L, 0x8FCB0562L, 0x9C9BF696L, 0x6EF07595L, 0x417B1DBCL, 0xB3109EBFL,
+        0xA0406D4BL, 0x522BEE48L, 0x86E18AA3L, 0x748A09A0L, 0x67DAFA54L, 0x95B17957L,
+        0xCBA24573L, 0x39C9C670L, 0x2A993584L, 0xD8F2B687L, 0x0C38D26CL, 0xFE53516FL,
+        0xED03A29BL, 0x1F682198L, 0x5125DAD3L, 0xA34E59D0L, 0xB01EAA24L, 0x42752927L,
+        0x96BF4DCCL, 0x64D4CECFL, 0x77843D3BL, 0x85EFBE38L, 0xDBFC821CL, 0x2997011FL,
+        0x3AC7F2EBL, 0xC8AC71E8L, 0x1C661503L, 0xEE0D9600L, 0xFD5D65F4L, 0x0F36E6F7L,
+        0x61C69362L, 0x93AD1061L, 0x80FDE395L, 0x72966096L, 0xA65C047DL, 0x5437877EL,
+        0x4767748AL, 0xB50CF789L, 0xEB1FCBADL, 0x197448AEL, 0x0A24BB5AL, 0xF84F3859L,
+        0x2C855CB2L, 0xDEEEDFB1L, 0xCDBE2C45L, 0x3FD5AF46L, 0x7198540DL, 0x83F3D70EL,
+        0x90A324FAL, 0x62C8A7F9L, 0xB602C312L, 0x44694011L, 0x5739B3E5L, 0xA55230E6L,
+        0xFB410CC2L, 0x092A8FC1L, 0x1A7A7C35L, 0xE811FF36L, 0x3CDB9BDDL, 0xCEB018DEL,
+        0xDDE0EB2AL, 0x2F8B6829L, 0x82F63B78L, 0x709DB87BL, 0x63CD4B8FL, 0x91A6C88CL,
+        0x456CAC67L, 0xB7072F64L, 0xA457DC90L, 0x563C5F93L, 0x082F63B7L, 0xFA44E0B4L,
+        0xE9141340L, 0x1B7F9043L, 0xCFB5F4A8L, 0x3DDE77ABL, 0x2E8E845FL, 0xDCE5075CL,
+        0x92A8FC17L, 0x60C37F14L, 0x73938CE0L, 0x81F80FE3L, 0x55326B08L, 0xA759E80BL,
+        0xB4091BFFL, 0x466298FCL, 0x1871A4D8L, 0xEA1A27DBL, 0xF94AD42FL, 0x0B21572CL,
+        0xDFEB33C7L, 0x2D80B0C4L, 0x3ED04330L, 0xCCBBC033L, 0xA24BB5A6L, 0x502036A5L,
+        0x4370C551L, 0xB11B4652L, 0x65D122B9L, 0x97BAA1BAL, 0x84EA524EL, 0x7681D14DL,
+        0x2892ED69L, 0xDAF96E6AL, 0xC9A99D9EL, 0x3BC21E9DL, 0xEF087A76L, 0x1D63F975L,
+        0x0E330A81L, 0xFC588982L, 0xB21572C9L, 0x407EF1CAL, 0x532E023EL, 0xA145813DL,
+        0x758FE5D6L, 0x87E466D5L, 0x94B49521L, 0x66DF1622L, 0x38CC2A06L, 0xCAA7A905L,
+        0xD9F75AF1L, 0x2B9CD9F2L, 0xFF56BD19L, 0x0D3D3E1AL, 0x1E6DCDEEL, 0xEC064EEDL,
+        0xC38D26C4L, 0x31E6A5C7L, 0x22B65633L, 0xD0DDD530L, 0x0417B1DBL, 0xF67C32D8L,
+        0xE52CC12CL, 0x1747422FL, 0x49547E0BL, 0xBB3FFD08L, 0xA86F0EFCL, 0x5A048DFFL,
+        0x8ECEE914L, 0x7CA56A17L, 0x6FF599E3L, 0x9D9E1AE0L, 0xD3D3E1ABL, 0x21B862A8L,
+        0x32E8915CL, 0xC083125FL, 0x144976B4L, 0xE622F5B7L, 0xF5720643L, 0x07198540L,
+        0x590AB964L, 0xAB613A67L, 0xB831C993L, 0x4A5A4A90L, 0x9E902E7BL, 0x6CFBAD78L,
+        0x7FAB5E8CL, 0x8DC0DD8FL, 0xE330A81AL, 0x115B2B19L, 0x020BD8EDL, 0xF0605BEEL,
+        0x24AA3F05L, 0xD6C1BC06L, 0xC5914FF2L, 0x37FACCF1L, 0x69E9F0D5L, 0x9B8273D6L,
+        0x88D28022L, 0x7AB90321L, 0xAE7367CAL, 0x5C18E4C9L, 0x4F48173DL, 0xBD23943EL,
+        0xF36E6F75L, 0x0105EC76L, 0x12551F82L, 0xE03E9C81L, 0x34F4F86AL, 0xC69F7B69L,
+        0xD5CF889DL, 0x27A40B9EL, 0x79B737BAL, 0x8BDCB4B9L, 0x988C474DL, 0x6AE7C44EL,
+        0xBE2DA0A5L, 0x4C4623A6L, 0x5F16D052L, 0xAD7D5351L
+        },
+        {
+        0x00000000L, 0x13A29877L, 0x274530EEL, 0x34E7A899L, 0x4E8A61DCL, 0x5D28F9ABL,
+        0x69CF5132L, 0x7A6DC945L, 0x9D14C3B8L, 0x8EB65BCFL, 0xBA51F356L, 0xA9F36B21L,
+        0xD39EA264L, 0xC03C3A13L, 0xF4DB928AL, 0xE7790AFDL, 0x3FC5F181L, 0x2C6769F6L,
+        0x1880C16FL, 0x0B225918L, 0x714F905DL, 0x62ED082AL, 0x560AA0B3L, 0x45A838C4L,
+        0xA2D13239L, 0xB173AA4EL, 0x859402D7L, 0x96369AA0L, 0xEC5B53E5L, 0xFFF9CB92L,
+        0xCB1E630BL, 0xD8BCFB7CL, 0x7F8BE302L, 0x6C297B75L, 0x58CED3ECL, 0x4B6C4B9BL,
+        0x310182DEL, 0x22A31AA9L, 0x1644B230L, 0x05E62A47L, 0xE29F20BAL, 0xF13DB8CDL,
+        0xC5DA1054L, 0xD6788823L, 0xAC154166L, 0xBFB7D911L, 0x8B507188L, 0x98F2E9FFL,
+        0x404E1283L, 0x53EC8AF4L, 0x670B226DL, 0x74A9BA1AL, 0x0EC4735FL, 0x1D66EB28L,
+        0x298143B1L, 0x3A23DBC6L, 0xDD5AD13BL, 0xCEF8494CL, 0xFA1FE1D5L, 0xE9BD79A2L,
+        0x93D0B0E7L, 0x80722890L, 0xB4958009L, 0xA737187EL, 0xFF17C604L, 0xECB55E73L,
+        0xD852F6EAL, 0xCBF06E9DL, 0xB19DA7D8L, 0xA23F3FAFL, 0x96D89736L, 0x857A0F41L,
+        0x620305BCL, 0x71A19DCBL, 0x45463552L, 0x56E4AD25L, 0x2C896460L, 0x3F2BFC17L,
+        0x0BCC548EL, 0x186ECCF9L, 0xC0D23785L, 0xD370AFF2L, 0xE797076BL, 0xF4359F1CL,
+        0x8E585659L, 0x9DFACE2EL, 0xA91D66B7L, 0xBABFFEC0L, 0x5DC6F43DL, 0x4E646C4AL,
+        0x7A83C4D3L, 0x69215CA4L, 0x134C95E1L, 0x00EE0D96L, 0x3409A50FL, 0x27AB3D78L,
+        0x809C2506L, 0x933EBD71L, 0xA7D915E8L, 0xB47B8D9FL, 0xCE1644DAL, 0xDDB4DCADL,
+        0xE9537434L, 0xFAF1EC43L, 0x1D88E6BEL, 0x0E2A7EC9L, 0x3ACDD650L, 0x296F4E27L,
+        0x53028762L, 0x40A01F15L, 0x7447B78CL, 0x67E52FFBL, 0xBF59D487L, 0xACFB4CF0L,
+        0x981CE469L, 0x8BBE7C1EL, 0xF1D3B55BL, 0xE2712D2CL, 0xD69685B5L, 0xC5341DC2L,
+        0x224D173FL, 0x31EF8F48L, 0x050827D1L, 0x16AABFA6L, 0x6CC776E3L, 0x7F65EE94L,
+        0x4B82460DL, 0x5820DE7AL, 0xFBC3FAF9L, 0xE861628EL, 0xDC86CA17L, 0xCF245260L,
+        0xB5499B25L, 0xA6EB0352L, 0x920CABCBL, 0x81AE33BCL, 0x66D73941L, 0x7575A136L,
+        0x419209AFL, 0x523091D8L, 0x285D589DL, 0x3BFFC0EAL, 0x0F186873L, 0x1CBAF004L,
+        0xC4060B78L, 0xD7A4930FL, 0xE3433B96L, 0xF0E1A3E1L, 0x8A8C6AA4L, 0x992EF2D3L,
+        0xADC95A4AL, 0xBE6BC23DL, 0x5912C8C0L, 0x4AB050B7L, 0x7E57F82EL, 0x6DF56059L,
+        0x1798A91CL, 0x043A316BL, 0x30DD99F2L, 0x237F0185L, 0x844819FBL, 0x97EA818CL,
+        0xA30D2915L, 0xB0AFB162L, 0xCAC27827L, 0xD960E050L, 0xED8748C9L, 0xFE25D0BEL,
+        0x195CDA43L, 0x0AFE4234L, 0x3E19EAADL, 0x2DBB72DAL, 0x57D6BB9FL, 0x447423E8L,
+        0x70938B71L, 0x63311306L, 0xBB8DE87AL, 0xA82F700DL, 0x9CC8D894L, 0x8F6A40E3L,
+        0xF50789A6L, 0xE6A511D1L, 0xD242B948L, 0xC1E0213FL, 0x26992BC2L, 0x353BB3B5L,
+        0x01DC1B2CL, 0x127E835BL, 0x68134A1EL, 0x7BB1D269L, 0x4F567AF0L, 0x5CF4E287L,
+        0x04D43CFDL, 0x1776A48AL, 0x23910C13L, 0x30339464L, 0x4A5E5D21L, 0x59FCC556L,
+        0x6D1B6DCFL, 0x7EB9F5B8L, 0x99C0FF45L, 0x8A626732L, 0xBE85CFABL, 0xAD2757DCL,
+        0xD74A9E99L, 0xC4E806EEL, 0xF00FAE77L, 0xE3AD3600L, 0x3B11CD7CL, 0x28B3550BL,
+        0x1C54FD92L, 0x0FF665E5L, 0x759BACA0L, 0x663934D7L, 0x52DE9C4EL, 0x417C0439L,
+        0xA6050EC4L, 0xB5A796B3L, 0x81403E2AL, 0x92E2A65DL, 0xE88F6F18L, 0xFB2DF76FL,
+        0xCFCA5FF6L, 0xDC68C781L, 0x7B5FDFFFL, 0x68FD4788L, 0x5C1AEF11L, 0x4FB87766L,
+        0x35D5BE23L, 0x26772654L, 0x12908ECDL, 0x013216BAL, 0xE64B1C47L, 0xF5E98430L,
+        0xC10E2CA9L, 0xD2ACB4DEL, 0xA8C17D9BL, 0xBB63E5ECL, 0x8F844D75L, 0x9C26D502L,
+        0x449A2E7EL, 0x5738B609L, 0x63DF1E90L, 0x707D86E7L, 0x0A104FA2L, 0x19B2D7D5L,
+        0x2D557F4CL, 0x3EF7E73BL, 0xD98EEDC6L, 0xCA2C75B1L, 0xFECBDD28L, 0xED69455FL,
+        0x97048C1AL, 0x84A6146DL, 0xB041BCF4L, 0xA3E32483L
+        },
+        {
+        0x00000000L, 0xA541927EL, 0x4F6F520DL, 0xEA2EC073L, 0x9EDEA41AL, 0x3B9F3664L,
+        0xD1B1F617L, 0x74F06469L, 0x38513EC5L, 0x9D10ACBBL, 0x773E6CC8L, 0xD27FFEB6L,
+        0xA68F9ADFL, 0x03CE08A1L, 0xE9E0C8D2L, 0x4CA15AACL, 0x70A27D8AL, 0xD5E3EFF4L,
+        0x3FCD2F87L, 0x9A8CBDF9L, 0xEE7CD990L, 0x4B3D4BEEL, 0xA1138B9DL, 0x045219E3L,
+        0x48F3434FL, 0xEDB2D131L, 0x079C1142L, 0xA2DD833CL, 0xD62DE755L, 0x736C752BL,
+        0x9942B558L, 0x3C032726L, 0xE144FB14L, 0x4405696AL, 0xAE2BA919L, 0x0B6A3B67L,
+        0x7F9A5F0EL, 0xDADBCD70L, 0x30F50D03L, 0x95B49F7DL, 0xD915C5D1L, 0x7C5457AFL,
+        0x967A97DCL, 0x333B05A2L, 0x47CB61CBL, 0xE28AF3B5L, 0x08A433C6L, 0xADE5A1B8L,
+        0x91E6869EL, 0x34A714E0L, 0xDE89D493L, 0x7BC846EDL, 0x0F382284L, 0xAA79B0FAL,
+        0x40577089L, 0xE516E2F7L, 0xA9B7B85BL, 0x0CF62A25L, 0xE6D8EA56L, 0x43997828L,
+        0x37691C41L, 0x92288E3FL, 0x78064E4CL, 0xDD47DC32L, 0xC76580D9L, 0x622412A7L,
+        0x880AD2D4L, 0x2D4B40AAL, 0x59BB24C3L, 0xFCFAB6BDL, 0x16D476CEL, 0xB395E4B0L,
+        0xFF34BE1CL, 0x5A752C62L, 0xB05BEC11L, 0x151A7E6FL, 0x61EA1A06L, 0xC4AB8878L,
+        0x2E85480BL, 0x8BC4DA75L, 0xB7C7FD53L, 0x12866F2DL, 0xF8A8AF5EL, 0x5DE93D20L,
+        0x29195949L, 0x8C58CB37L, 0x66760B44L, 0xC337993AL, 0x8F96C396L, 0x2AD751E8L,
+        0xC0F9919BL, 0x65B803E5L, 0x1148678CL, 0xB409F5F2L, 0x5E273581L, 0xFB66A7FFL,
+        0x26217BCDL, 0x8360E9B3L, 0x694E29C0L, 0xCC0FBBBEL, 0xB8FFDFD7L, 0x1DBE4DA9L,
+        0xF7908DDAL, 0x52D11FA4L, 0x1E704508L, 0xBB31D776L, 0x511F1705L, 0xF45E857BL,
+        0x80AEE112L, 0x25EF736CL, 0xCFC1B31FL, 0x6A802161L, 0x56830647L, 0xF3C29439L,
+        0x19EC544AL, 0xBCADC634L, 0xC85DA25DL, 0x6D1C3023L, 0x8732F050L, 0x2273622EL,
+        0x6ED23882L, 0xCB93AAFCL, 0x21BD6A8FL, 0x84FCF8F1L, 0xF00C9C98L, 0x554D0EE6L,
+        0xBF63CE95L, 0x1A225CEBL, 0x8B277743L, 0x2E66E53DL, 0xC448254EL, 0x6109B730L,
+        0x15F9D359L, 0xB0B84127L, 0x5A968154L, 0xFFD7132AL, 0xB3764986L, 0x1637DBF8L,
+        0xFC191B8BL, 0x595889F5L, 0x2DA8ED9CL, 0x88E97FE2L, 0x62C7BF91L, 0xC7862DEFL,
+        0xFB850AC9L, 0x5EC498B7L, 0xB4EA58C4L, 0x11ABCABAL, 0x655BAED3L, 0xC01A3CADL,
+        0x2A34FCDEL, 0x8F756EA0L, 0xC3D4340CL, 0x6695A672L, 0x8CBB6601L, 0x29FAF47FL,
+        0x5D0A9016L, 0xF84B0268L, 0x1265C21BL, 0xB7245065L, 0x6A638C57L, 0xCF221E29L,
+        0x250CDE5AL, 0x804D4C24L, 0xF4BD284DL, 0x51FCBA33L, 0xBBD27A40L, 0x1E93E83EL,
+        0x5232B292L, 0xF77320ECL, 0x1D5DE09FL, 0xB81C72E1L, 0xCCEC1688L, 0x69AD84F6L,
+        0x83834485L, 0x26C2D6FBL, 0x1AC1F1DDL, 0xBF8063A3L, 0x55AEA3D0L, 0xF0EF31AEL,
+        0x841F55C7L, 0x215EC7B9L, 0xCB7007CAL, 0x6E3195B4L, 0x2290CF18L, 0x87D15D66L,
+        0x6DFF9D15L, 0xC8BE0F6BL, 0xBC4E6B02L, 0x190FF97CL, 0xF321390FL, 0x5660AB71L,
+        0x4C42F79AL, 0xE90365E4L, 0x032DA597L, 0xA66C37E9L, 0xD29C5380L, 0x77DDC1FEL,
+        0x9DF3018DL, 0x38B293F3L, 0x7413C95FL, 0xD1525B21L, 0x3B7C9B52L, 0x9E3D092CL,
+        0xEACD6D45L, 0x4F8CFF3BL, 0xA5A23F48L, 0x00E3AD36L, 0x3CE08A10L, 0x99A1186EL,
+        0x738FD81DL, 0xD6CE4A63L, 0xA23E2E0AL, 0x077FBC74L, 0xED517C07L, 0x4810EE79L,
+        0x04B1B4D5L, 0xA1F026ABL, 0x4BDEE6D8L, 0xEE9F74A6L, 0x9A6F10CFL, 0x3F2E82B1L,
+        0xD50042C2L, 0x7041D0BCL, 0xAD060C8EL, 0x08479EF0L, 0xE2695E83L, 0x4728CCFDL,
+        0x33D8A894L, 0x96993AEAL, 0x7CB7FA99L, 0xD9F668E7L, 0x9557324BL, 0x3016A035L,
+        0xDA386046L, 0x7F79F238L, 0x0B899651L, 0xAEC8042FL, 0x44E6C45CL, 0xE1A75622L,
+        0xDDA47104L, 0x78E5E37AL, 0x92CB2309L, 0x378AB177L, 0x437AD51EL, 0xE63B4760L,
+        0x0C158713L, 0xA954156DL, 0xE5F54FC1L, 0x40B4DDBFL, 0xAA9A1DCCL, 0x0FDB8FB2L,
+        0x7B2BEBDBL, 0xDE6A79A5L, 0x3444B9D6L, 0x91052BA8L
+        },
+        {
+        0x00000000L, 0xDD45AAB8L, 0xBF672381L, 0x62228939L, 0x7B2231F3L, 0xA6679B4BL,
+        0xC4451272L, 0x1900B8CAL, 0xF64463E6L, 0x2B01C95EL, 0x49234067L, 0x9466EADFL,
+        0x8D665215L, 0x5023F8ADL, 0x32017194L, 0xEF44DB2CL, 0xE964B13DL, 0x34211B85L,
+        0x560392BCL, 0x8B463804L, 0x924680CEL, 0x4F032A76L, 0x2D21A34FL, 0xF06409F7L,
+        0x1F20D2DBL, 0xC2657863L, 0xA047F15AL, 0x7D025BE2L, 0x6402E328L, 0xB9474990L,
+        0xDB65C0A9L, 0x06206A11L, 0xD725148BL, 0x0A60BE33L, 0x6842370AL, 0xB5079DB2L,
+        0xAC072578L, 0x71428FC0L, 0x136006F9L, 0xCE25AC41L, 0x2161776DL, 0xFC24DDD5L,
+        0x9E0654ECL, 0x4343FE54L, 0x5A43469EL, 0x8706EC26L, 0xE524651FL, 0x3861CFA7L,
+        0x3E41A5B6L, 0xE3040F0EL, 0x81268637L, 0x5C632C8FL, 0x45639445L, 0x98263EFDL,
+        0xFA04B7C4L, 0x27411D7CL, 0xC805C650L, 0x15406CE8L, 0x7762E5D1L, 0xAA274F69L,
+        0xB327F7A3L, 0x6E625D1BL, 0x0C40D422L, 0xD1057E9AL, 0xABA65FE7L, 0x76E3F55FL,
+        0x14C17C66L, 0xC984D6DEL, 0xD0846E14L, 0x0DC1C4ACL, 0x6FE34D95L, 0xB2A6E72DL,
+        0x5DE23C01L, 0x80A796B9L, 0xE2851F80L, 0x3FC0B538L, 0x26C00DF2L, 0xFB85A74AL,
+        0x99A72E73L, 0x44E284CBL, 0x42C2EEDAL, 0x9F874462L, 0xFDA5CD5BL, 0x20E067E3L,
+        0x39E0DF29L, 0xE4A57591L, 0x8687FCA8L, 0x5BC25610L, 0xB4868D3CL, 0x69C32784L,
+        0x0BE1AEBDL, 0xD6A40405L, 0xCFA4BCCFL, 0x12E11677L, 0x70C39F4EL, 0xAD8635F6L,
+        0x7C834B6CL, 0xA1C6E1D4L, 0xC3E468EDL, 0x1EA1C255L, 0x07A17A9FL, 0xDAE4D027L,
+        0xB8C6591EL, 0x6583F3A6L, 0x8AC7288AL, 0x57828232L, 0x35A00B0BL, 0xE8E5A1B3L,
+        0xF1E51979L, 0x2CA0B3C1L, 0x4E823AF8L, 0x93C79040L, 0x95E7FA51L, 0x48A250E9L,
+        0x2A80D9D0L, 0xF7C57368L, 0xEEC5CBA2L, 0x3380611AL, 0x51A2E823L, 0x8CE7429BL,
+        0x63A399B7L, 0xBEE6330FL, 0xDCC4BA36L, 0x0181108EL, 0x1881A844L, 0xC5C402FCL,
+        0xA7E68BC5L, 0x7AA3217DL, 0x52A0C93FL, 0x8FE56387L, 0xEDC7EABEL, 0x30824006L,
+        0x2982F8CCL, 0xF4C75274L, 0x96E5DB4DL, 0x4BA071F5L, 0xA4E4AAD9L, 0x79A10061L,
+        0x1B838958L, 0xC6C623E0L, 0xDFC69B2AL, 0x02833192L, 0x60A1B8ABL, 0xBDE41213L,
+        0xBBC47802L, 0x6681D2BAL, 0x04A35B83L, 0xD9E6F13BL, 0xC0E649F1L, 0x1DA3E349L,
+        0x7F816A70L, 0xA2C4C0C8L, 0x4D801BE4L, 0x90C5B15CL, 0xF2E73865L, 0x2FA292DDL,
+        0x36A22A17L, 0xEBE780AFL, 0x89C50996L, 0x5480A32EL, 0x8585DDB4L, 0x58C0770CL,
+        0x3AE2FE35L, 0xE7A7548DL, 0xFEA7EC47L, 0x23E246FFL, 0x41C0CFC6L, 0x9C85657EL,
+        0x73C1BE52L, 0xAE8414EAL, 0xCCA69DD3L, 0x11E3376BL, 0x08E38FA1L, 0xD5A62519L,
+        0xB784AC20L, 0x6AC10698L, 0x6CE16C89L, 0xB1A4C631L, 0xD3864F08L, 0x0EC3E5B0L,
+        0x17C35D7AL, 0xCA86F7C2L, 0xA8A47EFBL, 0x75E1D443L, 0x9AA50F6FL, 0x47E0A5D7L,
+        0x25C22CEEL, 0xF8878656L, 0xE1873E9CL, 0x3CC29424L, 0x5EE01D1DL, 0x83A5B7A5L,
+        0xF90696D8L, 0x24433C60L, 0x4661B559L, 0x9B241FE1L, 0x8224A72BL, 0x5F610D93L,
+        0x3D4384AAL, 0xE0062E12L, 0x0F42F53EL, 0xD2075F86L, 0xB025D6BFL, 0x6D607C07L,
+        0x7460C4CDL, 0xA9256E75L, 0xCB07E74CL, 0x16424DF4L, 0x106227E5L, 0xCD278D5DL,
+        0xAF050464L, 0x7240AEDCL, 0x6B401616L, 0xB605BCAEL, 0xD4273597L, 0x09629F2FL,
+        0xE6264403L, 0x3B63EEBBL, 0x59416782L, 0x8404CD3AL, 0x9D0475F0L, 0x4041DF48L,
+        0x22635671L, 0xFF26FCC9L, 0x2E238253L, 0xF36628EBL, 0x9144A1D2L, 0x4C010B6AL,
+        0x5501B3A0L, 0x88441918L, 0xEA669021L, 0x37233A99L, 0xD867E1B5L, 0x05224B0DL,
+        0x6700C234L, 0xBA45688CL, 0xA345D046L, 0x7E007AFEL, 0x1C22F3C7L, 0xC167597FL,
+        0xC747336EL, 0x1A0299D6L, 0x782010EFL, 0xA565BA57L, 0xBC65029DL, 0x6120A825L,
+        0x0302211CL, 0xDE478BA4L, 0x31035088L, 0xEC46FA30L, 0x8E647309L, 0x5321D9B1L,
+        0x4A21617BL, 0x9764CBC3L, 0xF54642FAL, 0x2803E842L
+        },
+        {
+        0x00000000L, 0x38116FACL, 0x7022DF58L, 0x4833B0F4L, 0xE045BEB0L, 0xD854D11CL,
+        0x906761E8L, 0xA8760E44L, 0xC5670B91L, 0xFD76643DL, 0xB545D4C9L, 0x8D54BB65L,
+        0x2522B521L, 0x1D33DA8DL, 0x55006A79L, 0x6D1105D5L, 0x8F2261D3L, 0xB7330E7FL,
+        0xFF00BE8BL, 0xC711D127L, 0x6F67DF63L, 0x5776B0CFL, 0x1F45003BL, 0x27546F97L,
+        0x4A456A42L, 0x725405EEL, 0x3A67B51AL, 0x0276DAB6L, 0xAA00D4F2L, 0x9211BB5EL,
+        0xDA220BAAL, 0xE2336406L, 0x1BA8B557L, 0x23B9DAFBL, 0x6B8A6A0FL, 0x539B05A3L,
+        0xFBED0BE7L, 0xC3FC644BL, 0x8BCFD4BFL, 0xB3DEBB13L, 0xDECFBEC6L, 0xE6DED16AL,
+        0xAEED619EL, 0x96FC0E32L, 0x3E8A0076L, 0x069B6FDAL, 0x4EA8DF2EL, 0x76B9B082L,
+        0x948AD484L, 0xAC9BBB28L, 0xE4A80BDCL, 0xDCB96470L, 0x74CF6A34L, 0x4CDE0598L,
+        0x04EDB56CL, 0x3CFCDAC0L, 0x51EDDF15L, 0x69FCB0B9L, 0x21CF004DL, 0x19DE6FE1L,
+        0xB1A861A5L, 0x89B90E09L, 0xC18ABEFDL, 0xF99BD151L, 0x37516AAEL, 0x0F400502L,
+        0x4773B5F6L, 0x7F62DA5AL, 0xD714D41EL, 0xEF05BBB2L, 0xA7360B46L, 0x9F2764EAL,
+        0xF236613FL, 0xCA270E93L, 0x8214BE67L, 0xBA05D1CBL, 0x1273DF8FL, 0x2A62B023L,
+        0x625100D7L, 0x5A406F7BL, 0xB8730B7DL, 0x806264D1L, 0xC851D425L, 0xF040BB89L,
+        0x5836B5CDL, 0x6027DA61L, 0x28146A95L, 0x10050539L, 0x7D1400ECL, 0x45056F40L,
+        0x0D36DFB4L, 0x3527B018L, 0x9D51BE5CL, 0xA540D1F0L, 0xED736104L, 0xD5620EA8L,
+        0x2CF9DFF9L, 0x14E8B055L, 0x5CDB00A1L, 0x64CA6F0DL, 0xCCBC6149L, 0xF4AD0EE5L,
+        0xBC9EBE11L, 0x848FD1BDL, 0xE99ED468L, 0xD18FBBC4L, 0x99BC0B30L, 0xA1AD649CL,
+        0x09DB6AD8L, 0x31CA0574L, 0x79F9B580L, 0x41E8DA2CL, 0xA3DBBE2AL, 0x9BCAD186L,
+        0xD3F96172L, 0xEBE80EDEL, 0x439E009AL, 0x7B8F6F36L, 0x33BCDFC2L, 0x0BADB06EL,
+        0x66BCB5BBL, 0x5EADDA17L, 0x169E6AE3L, 0x2E8F054FL, 0x86F90B0BL, 0xBEE864A7L,
+        0xF6DBD453L, 0xCECABBFFL, 0x6EA2D55CL, 0x56B3BAF0L, 0x1E800A04L, 0x269165A8L,
+        0x8EE76BECL, 0xB6F60440L, 0xFEC5B4B4L, 0xC6D4DB18L, 0xABC5DECDL, 0x93D4B161L,
+        0xDBE70195L, 0xE3F66E39L, 0x4B80607DL, 0x73910FD1L, 0x3BA2BF25L, 0x03B3D089L,
+        0xE180B48FL, 0xD991DB23L, 0x91A26BD7L, 0xA9B3047BL, 0x01C50A3FL, 0x39D46593L,
+        0x71E7D567L, 0x49F6BACBL, 0x24E7BF1EL, 0x1CF6D0B2L, 0x54C56046L, 0x6CD40FEAL,
+        0xC4A201AEL, 0xFCB36E02L, 0xB480DEF6L, 0x8C91B15AL, 0x750A600BL, 0x4D1B0FA7L,
+        0x0528BF53L, 0x3D39D0FFL, 0x954FDEBBL, 0xAD5EB117L, 0xE56D01E3L, 0xDD7C6E4FL,
+        0xB06D6B9AL, 0x887C0436L, 0xC04FB4C2L, 0xF85EDB6EL, 0x5028D52AL, 0x6839BA86L,
+        0x200A0A72L, 0x181B65DEL, 0xFA2801D8L, 0xC2396E74L, 0x8A0ADE80L, 0xB21BB12CL,
+        0x1A6DBF68L, 0x227CD0C4L, 0x6A4F6030L, 0x525E0F9CL, 0x3F4F0A49L, 0x075E65E5L,
+        0x4F6DD511L, 0x777CBABDL, 0xDF0AB4F9L, 0xE71BDB55L, 0xAF286BA1L, 0x9739040DL,
+        0x59F3BFF2L, 0x61E2D05EL, 0x29D160AAL, 0x11C00F06L, 0xB9B60142L, 0x81A76EEEL,
+        0xC994DE1AL, 0xF185B1B6L, 0x9C94B463L, 0xA485DBCFL, 0xECB66B3BL, 0xD4A70497L,
+        0x7CD10AD3L, 0x44C0657FL, 0x0CF3D58BL, 0x34E2BA27L, 0xD6D1DE21L, 0xEEC0B18DL,
+        0xA6F30179L, 0x9EE26ED5L, 0x36946091L, 0x0E850F3DL, 0x46B6BFC9L, 0x7EA7D065L,
+        0x13B6D5B0L, 0x2BA7BA1CL, 0x63940AE8L, 0x5B856544L, 0xF3F36B00L, 0xCBE204ACL,
+        0x83D1B458L, 0xBBC0DBF4L, 0x425B0AA5L, 0x7A4A6509L, 0x3279D5FDL, 0x0A68BA51L,
+        0xA21EB415L, 0x9A0FDBB9L, 0xD23C6B4DL, 0xEA2D04E1L, 0x873C0134L, 0xBF2D6E98L,
+        0xF71EDE6CL, 0xCF0FB1C0L, 0x6779BF84L, 0x5F68D028L, 0x175B60DCL, 0x2F4A0F70L,
+        0xCD796B76L, 0xF56804DAL, 0xBD5BB42EL, 0x854ADB82L, 0x2D3CD5C6L, 0x152DBA6AL,
+        0x5D1E0A9EL, 0x650F6532L, 0x081E60E7L, 0x300F0F4BL, 0x783CBFBFL, 0x402DD013L,
+        0xE85BDE57L, 0xD04AB1FBL, 0x9879010FL, 0xA0686EA3L
+        },
+        {
+        0x00000000L, 0xEF306B19L, 0xDB8CA0C3L, 0x34BCCBDAL, 0xB2F53777L, 0x5DC55C6EL,
+        0x697997B4L, 0x8649FCADL, 0x6006181FL, 0x8F367306L, 0xBB8AB8DCL, 0x54BAD3C5L,
+        0xD2F32F68L, 0x3DC34471L, 0x097F8FABL, 0xE64FE4B2L, 0xC00C303EL, 0x2F3C5B27L,
+        0x1B8090FDL, 0xF4B0FBE4L, 0x72F90749L, 0x9DC96C50L, 0xA975A78AL, 0x4645CC93L,
+        0xA00A2821L, 0x4F3A4338L, 0x7B8688E2L, 0x94B6E3FBL, 0x12FF1F56L, 0xFDCF744FL,
+        0xC973BF95L, 0x2643D48CL, 0x85F4168DL, 0x6AC47D94L, 0x5E78B64EL, 0xB148DD57L,
+        0x370121FAL, 0xD8314AE3L, 0xEC8D8139L, 0x03BDEA20L, 0xE5F20E92L, 0x0AC2658BL,
+        0x3E7EAE51L, 0xD14EC548L, 0x570739E5L, 0xB83752FCL, 0x8C8B9926L, 0x63BBF23FL,
+        0x45F826B3L, 0xAAC84DAAL, 0x9E748670L, 0x7144ED69L, 0xF70D11C4L, 0x183D7ADDL,
+        0x2C81B107L, 0xC3B1DA1EL, 0x25FE3EACL, 0xCACE55B5L, 0xFE729E6FL, 0x1142F576L,
+        0x970B09DBL, 0x783B62C2L, 0x4C87A918L, 0xA3B7C201L, 0x0E045BEBL, 0xE13430F2L,
+        0xD588FB28L, 0x3AB89031L, 0xBCF16C9CL, 0x53C10785L, 0x677DCC5FL, 0x884DA746L,
+        0x6E0243F4L, 0x813228EDL, 0xB58EE337L, 0x5ABE882EL, 0xDCF77483L, 0x33C71F9AL,
+        0x077BD440L, 0xE84BBF59L, 0xCE086BD5L, 0x213800CCL, 0x1584CB16L, 0xFAB4A00FL,
+        0x7CFD5CA2L, 0x93CD37BBL, 0xA771FC61L, 0x48419778L, 0xAE0E73CAL, 0x413E18D3L,
+        0x7582D309L, 0x9AB2B810L, 0x1CFB44BDL, 0xF3CB2FA4L, 0xC777E47EL, 0x28478F67L,
+        0x8BF04D66L, 0x64C0267FL, 0x507CEDA5L, 0xBF4C86BCL, 0x39057A11L, 0xD6351108L,
+        0xE289DAD2L, 0x0DB9B1CBL, 0xEBF65579L, 0x04C63E60L, 0x307AF5BAL, 0xDF4A9EA3L,
+        0x5903620EL, 0xB6330917L, 0x828FC2CDL, 0x6DBFA9D4L, 0x4BFC7D58L, 0xA4CC1641L,
+        0x9070DD9BL, 0x7F40B682L, 0xF9094A2FL, 0x16392136L, 0x2285EAECL, 0xCDB581F5L,
+        0x2BFA6547L, 0xC4CA0E5EL, 0xF076C584L, 0x1F46AE9DL, 0x990F5230L, 0x763F3929L,
+        0x4283F2F3L, 0xADB399EAL, 0x1C08B7D6L, 0xF338DCCFL, 0xC7841715L, 0x28B47C0CL,
+        0xAEFD80A1L, 0x41CDEBB8L, 0x75712062L, 0x9A414B7BL, 0x7C0EAFC9L, 0x933EC4D0L,
+        0xA7820F0AL, 0x48B26413L, 0xCEFB98BEL, 0x21CBF3A7L, 0x1577387DL, 0xFA475364L,
+        0xDC0487E8L, 0x3334ECF1L, 0x0788272BL, 0xE8B84C32L, 0x6EF1B09FL, 0x81C1DB86L,
+        0xB57D105CL, 0x5A4D7B45L, 0xBC029FF7L, 0x5332F4EEL, 0x678E3F34L, 0x88BE542DL,
+        0x0EF7A880L, 0xE1C7C399L, 0xD57B0843L, 0x3A4B635AL, 0x99FCA15BL, 0x76CCCA42L,
+        0x42700198L, 0xAD406A81L, 0x2B09962CL, 0xC439FD35L, 0xF08536EFL, 0x1FB55DF6L,
+        0xF9FAB944L, 0x16CAD25DL, 0x22761987L, 0xCD46729EL, 0x4B0F8E33L, 0xA43FE52AL,
+        0x90832EF0L, 0x7FB345E9L, 0x59F09165L, 0xB6C0FA7CL, 0x827C31A6L, 0x6D4C5ABFL,
+        0xEB05A612L, 0x0435CD0BL, 0x308906D1L, 0xDFB96DC8L, 0x39F6897AL, 0xD6C6E263L,
+        0xE27A29B9L, 0x0D4A42A0L, 0x8B03BE0DL, 0x6433D514L, 0x508F1ECEL, 0xBFBF75D7L,
+        0x120CEC3DL, 0xFD3C8724L, 0xC9804CFEL, 0x26B027E7L, 0xA0F9DB4AL, 0x4FC9B053L,
+        0x7B757B89L, 0x94451090L, 0x720AF422L, 0x9D3A9F3BL, 0xA98654E1L, 0x46B63FF8L,
+        0xC0FFC355L, 0x2FCFA84CL, 0x1B736396L, 0xF443088FL, 0xD200DC03L, 0x3D30B71AL,
+        0x098C7CC0L, 0xE6BC17D9L, 0x60F5EB74L, 0x8FC5806DL, 0xBB794BB7L, 0x544920AEL,
+        0xB206C41CL, 0x5D36AF05L, 0x698A64DFL, 0x86BA0FC6L, 0x00F3F36BL, 0xEFC39872L,
+        0xDB7F53A8L, 0x344F38B1L, 0x97F8FAB0L, 0x78C891A9L, 0x4C745A73L, 0xA344316AL,
+        0x250DCDC7L, 0xCA3DA6DEL, 0xFE816D04L, 0x11B1061DL, 0xF7FEE2AFL, 0x18CE89B6L,
+        0x2C72426CL, 0xC3422975L, 0x450BD5D8L, 0xAA3BBEC1L, 0x9E87751BL, 0x71B71E02L,
+        0x57F4CA8EL, 0xB8C4A197L, 0x8C786A4DL, 0x63480154L, 0xE501FDF9L, 0x0A3196E0L,
+        0x3E8D5D3AL, 0xD1BD3623L, 0x37F2D291L, 0xD8C2B988L, 0xEC7E7252L, 0x034E194BL,
+        0x8507E5E6L, 0x6A378EFFL, 0x5E8B4525L, 0xB1BB2E3CL
+        },
+        {
+        0x00000000L, 0x68032CC8L, 0xD0065990L, 0xB8057558L, 0xA5E0C5D1L, 0xCDE3E919L,
+        0x75E69C41L, 0x1DE5B089L, 0x4E2DFD53L, 0x262ED19BL, 0x9E2BA4C3L, 0xF628880BL,
+        0xEBCD3882L, 0x83CE144AL, 0x3BCB6112L, 0x53C84DDAL, 0x9C5BFAA6L, 0xF458D66EL,
+        0x4C5DA336L, 0x245E8FFEL, 0x39BB3F77L, 0x51B813BFL, 0xE9BD66E7L, 0x81BE4A2FL,
+        0xD27607F5L, 0xBA752B3DL, 0x02705E65L, 0x6A7372ADL, 0x7796C224L, 0x1F95EEECL,
+        0xA7909BB4L, 0xCF93B77CL, 0x3D5B83BDL, 0x5558AF75L, 0xED5DDA2DL, 0x855EF6E5L,
+        0x98BB466CL, 0xF0B86AA4L, 0x48BD1FFCL, 0x20BE3334L, 0x73767EEEL, 0x1B755226L,
+        0xA370277EL, 0xCB730BB6L, 0xD696BB3FL, 0xBE9597F7L, 0x0690E2AFL, 0x6E93CE67L,
+        0xA100791BL, 0xC90355D3L, 0x7106208BL, 0x19050C43L, 0x04E0BCCAL, 0x6CE39002L,
+        0xD4E6E55AL, 0xBCE5C992L, 0xEF2D8448L, 0x872EA880L, 0x3F2BDDD8L, 0x5728F110L,
+        0x4ACD4199L, 0x22CE6D51L, 0x9ACB1809L, 0xF2C834C1L, 0x7AB7077AL, 0x12B42BB2L,
+        0xAAB15EEAL, 0xC2B27222L, 0xDF57C2ABL, 0xB754EE63L, 0x0F519B3BL, 0x6752B7F3L,
+        0x349AFA29L, 0x5C99D6E1L, 0xE49CA3B9L, 0x8C9F8F71L, 0x917A3FF8L, 0xF9791330L,
+        0x417C6668L, 0x297F4AA0L, 0xE6ECFDDCL, 0x8EEFD114L, 0x36EAA44CL, 0x5EE98884L,
+        0x430C380DL, 0x2B0F14C5L, 0x930A619DL, 0xFB094D55L, 0xA8C1008FL, 0xC0C22C47L,
+        0x78C7591FL, 0x10C475D7L, 0x0D21C55EL, 0x6522E996L, 0xDD279CCEL, 0xB524B006L,
+        0x47EC84C7L, 0x2FEFA80FL, 0x97EADD57L, 0xFFE9F19FL, 0xE20C4116L, 0x8A0F6DDEL,
+        0x320A1886L, 0x5A09344EL, 0x09C17994L, 0x61C2555CL, 0xD9C72004L, 0xB1C40CCCL,
+        0xAC21BC45L, 0xC422908DL, 0x7C27E5D5L, 0x1424C91DL, 0xDBB77E61L, 0xB3B452A9L,
+        0x0BB127F1L, 0x63B20B39L, 0x7E57BBB0L, 0x16549778L, 0xAE51E220L, 0xC652CEE8L,
+        0x959A8332L, 0xFD99AFFAL, 0x459CDAA2L, 0x2D9FF66AL, 0x307A46E3L, 0x58796A2BL,
+        0xE07C1F73L, 0x887F33BBL, 0xF56E0EF4L, 0x9D6D223CL, 0x25685764L, 0x4D6B7BACL,
+        0x508ECB25L, 0x388DE7EDL, 0x808892B5L, 0xE88BBE7DL, 0xBB43F3A7L, 0xD340DF6FL,
+        0x6B45AA37L, 0x034686FFL, 0x1EA33676L, 0x76A01ABEL, 0xCEA56FE6L, 0xA6A6432EL,
+        0x6935F452L, 0x0136D89AL, 0xB933ADC2L, 0xD130810AL, 0xCCD53183L, 0xA4D61D4BL,
+        0x1CD36813L, 0x74D044DBL, 0x27180901L, 0x4F1B25C9L, 0xF71E5091L, 0x9F1D7C59L,
+        0x82F8CCD0L, 0xEAFBE018L, 0x52FE9540L, 0x3AFDB988L, 0xC8358D49L, 0xA036A181L,
+        0x1833D4D9L, 0x7030F811L, 0x6DD54898L, 0x05D66450L, 0xBDD31108L, 0xD5D03DC0L,
+        0x8618701AL, 0xEE1B5CD2L, 0x561E298AL, 0x3E1D0542L, 0x23F8B5CBL, 0x4BFB9903L,
+        0xF3FEEC5BL, 0x9BFDC093L, 0x546E77EFL, 0x3C6D5B27L, 0x84682E7FL, 0xEC6B02B7L,
+        0xF18EB23EL, 0x998D9EF6L, 0x2188EBAEL, 0x498BC766L, 0x1A438ABCL, 0x7240A674L,
+        0xCA45D32CL, 0xA246FFE4L, 0xBFA34F6DL, 0xD7A063A5L, 0x6FA516FDL, 0x07A63A35L,
+        0x8FD9098EL, 0xE7DA2546L, 0x5FDF501EL, 0x37DC7CD6L, 0x2A39CC5FL, 0x423AE097L,
+        0xFA3F95CFL, 0x923CB907L, 0xC1F4F4DDL, 0xA9F7D815L, 0x11F2AD4DL, 0x79F18185L,
+        0x6414310CL, 0x0C171DC4L, 0xB412689CL, 0xDC114454L, 0x1382F328L, 0x7B81DFE0L,
+        0xC384AAB8L, 0xAB878670L, 0xB66236F9L, 0xDE611A31L, 0x66646F69L, 0x0E6743A1L,
+        0x5DAF0E7BL, 0x35AC22B3L, 0x8DA957EBL, 0xE5AA7B23L, 0xF84FCBAAL, 0x904CE762L,
+        0x2849923AL, 0x404ABEF2L, 0xB2828A33L, 0xDA81A6FBL, 0x6284D3A3L, 0x0A87FF6BL,
+        0x17624FE2L, 0x7F61632AL, 0xC7641672L, 0xAF673ABAL, 0xFCAF7760L, 0x94AC5BA8L,
+        0x2CA92EF0L, 0x44AA0238L, 0x594FB2B1L, 0x314C9E79L, 0x8949EB21L, 0xE14AC7E9L,
+        0x2ED97095L, 0x46DA5C5DL, 0xFEDF2905L, 0x96DC05CDL, 0x8B39B544L, 0xE33A998CL,
+        0x5B3FECD4L, 0x333CC01CL, 0x60F48DC6L, 0x08F7A10EL, 0xB0F2D456L, 0xD8F1F89EL,
+        0xC5144817L, 0xAD1764DFL, 0x15121187L, 0x7D113D4FL
+        },
+        {
+        0x00000000L, 0x493C7D27L, 0x9278FA4EL, 0xDB448769L, 0x211D826DL, 0x6821FF4AL,
+        0xB3657823L, 0xFA590504L, 0x423B04DAL, 0x0B0779FDL, 0xD043FE94L, 0x997F83B3L,
+        0x632686B7L, 0x2A1AFB90L, 0xF15E7CF9L, 0xB86201DEL, 0x847609B4L, 0xCD4A7493L,
+        0x160EF3FAL, 0x5F328EDDL, 0xA56B8BD9L, 0xEC57F6FEL, 0x37137197L, 0x7E2F0CB0L,
+        0xC64D0D6EL, 0x8F717049L, 0x5435F720L, 0x1D098A07L, 0xE7508F03L, 0xAE6CF224L,
+        0x7528754DL, 0x3C14086AL, 0x0D006599L, 0x443C18BEL, 0x9F789FD7L, 0xD644E2F0L,
+        0x2C1DE7F4L, 0x65219AD3L, 0xBE651DBAL, 0xF759609DL, 0x4F3B6143L, 0x06071C64L,
+        0xDD439B0DL, 0x947FE62AL, 0x6E26E32EL, 0x271A9E09L, 0xFC5E1960L, 0xB5626447L,
+        0x89766C2DL, 0xC04A110AL, 0x1B0E9663L, 0x5232EB44L, 0xA86BEE40L, 0xE1579367L,
+        0x3A13140EL, 0x732F6929L, 0xCB4D68F7L, 0x827115D0L, 0x593592B9L, 0x1009EF9EL,
+        0xEA50EA9AL, 0xA36C97BDL, 0x782810D4L, 0x31146DF3L, 0x1A00CB32L, 0x533CB615L,
+        0x8878317CL, 0xC1444C5BL, 0x3B1D495FL, 0x72213478L, 0xA965B311L, 0xE059CE36L,
+        0x583BCFE8L, 0x1107B2CFL, 0xCA4335A6L, 0x837F4881L, 0x79264D85L, 0x301A30A2L,
+        0xEB5EB7CBL, 0xA262CAECL, 0x9E76C286L, 0xD74ABFA1L, 0x0C0E38C8L, 0x453245EFL,
+        0xBF6B40EBL, 0xF6573DCCL, 0x2D13BAA5L, 0x642FC782L, 0xDC4DC65CL, 0x9571BB7BL,
+        0x4E353C12L, 0x07094135L, 0xFD504431L, 0xB46C3916L, 0x6F28BE7FL, 0x2614C358L,
+        0x1700AEABL, 0x5E3CD38CL, 0x857854E5L, 0xCC4429C2L, 0x361D2CC6L, 0x7F2151E1L,
+        0xA465D688L, 0xED59ABAFL, 0x553BAA71L, 0x1C07D756L, 0xC743503FL, 0x8E7F2D18L,
+        0x7426281CL, 0x3D1A553BL, 0xE65ED252L, 0xAF62AF75L, 0x9376A71FL, 0xDA4ADA38L,
+        0x010E5D51L, 0x48322076L, 0xB26B2572L, 0xFB575855L, 0x2013DF3CL, 0x692FA21BL,
+        0xD14DA3C5L, 0x9871DEE2L, 0x4335598BL, 0x0A0924ACL, 0xF05021A8L, 0xB96C5C8FL,
+        0x6228DBE6L, 0x2B14A6C1L, 0x34019664L, 0x7D3DEB43L, 0xA6796C2AL, 0xEF45110DL,
+        0x151C1409L, 0x5C20692EL, 0x8764EE47L, 0xCE589360L, 0x763A92BEL, 0x3F06EF99L,
+        0xE44268F0L, 0xAD7E15D7L, 0x572710D3L, 0x1E1B6DF4L, 0xC55FEA9DL, 0x8C6397BAL,
+        0xB0779FD0L, 0xF94BE2F7L, 0x220F659EL, 0x6B3318B9L, 0x916A1DBDL, 0xD856609AL,
+        0x0312E7F3L, 0x4A2E9AD4L, 0xF24C9B0AL, 0xBB70E62DL, 0x60346144L, 0x29081C63L,
+        0xD3511967L, 0x9A6D6440L, 0x4129E329L, 0x08159E0EL, 0x3901F3FDL, 0x703D8EDAL,
+        0xAB7909B3L, 0xE2457494L, 0x181C7190L, 0x51200CB7L, 0x8A648BDEL, 0xC358F6F9L,
+        0x7B3AF727L, 0x32068A00L, 0xE9420D69L, 0xA07E704EL, 0x5A27754AL, 0x131B086DL,
+        0xC85F8F04L, 0x8163F223L, 0xBD77FA49L, 0xF44B876EL, 0x2F0F0007L, 0x66337D20L,
+        0x9C6A7824L, 0xD5560503L, 0x0E12826AL, 0x472EFF4DL, 0xFF4CFE93L, 0xB67083B4L,
+        0x6D3404DDL, 0x240879FAL, 0xDE517CFEL, 0x976D01D9L, 0x4C2986B0L, 0x0515FB97L,
+        0x2E015D56L, 0x673D2071L, 0xBC79A718L, 0xF545DA3FL, 0x0F1CDF3BL, 0x4620A21CL,
+        0x9D642575L, 0xD4585852L, 0x6C3A598CL, 0x250624ABL, 0xFE42A3C2L, 0xB77EDEE5L,
+        0x4D27DBE1L, 0x041BA6C6L, 0xDF5F21AFL, 0x96635C88L, 0xAA7754E2L, 0xE34B29C5L,
+        0x380FAEACL, 0x7133D38BL, 0x8B6AD68FL, 0xC256ABA8L, 0x19122CC1L, 0x502E51E6L,
+        0xE84C5038L, 0xA1702D1FL, 0x7A34AA76L, 0x3308D751L, 0xC951D255L, 0x806DAF72L,
+        0x5B29281BL, 0x1215553CL, 0x230138CFL, 0x6A3D45E8L, 0xB179C281L, 0xF845BFA6L,
+        0x021CBAA2L, 0x4B20C785L, 0x906440ECL, 0xD9583DCBL, 0x613A3C15L, 0x28064132L,
+        0xF342C65BL, 0xBA7EBB7CL, 0x4027BE78L, 0x091BC35FL, 0xD25F4436L, 0x9B633911L,
+        0xA777317BL, 0xEE4B4C5CL, 0x350FCB35L, 0x7C33B612L, 0x866AB316L, 0xCF56CE31L,
+        0x14124958L, 0x5D2E347FL, 0xE54C35A1L, 0xAC704886L, 0x7734CFEFL, 0x3E08B2C8L,
+        0xC451B7CCL, 0x8D6DCAEBL, 0x56294D82L, 0x1F1530A5L
+        }
+    };
+
+#ifdef CRC32C_HAVE_SSE42
+
+static const uint32_t crc32c_long[4][256] =
+    {
+        {
+        0x00000000L, 0xE040E0ACL, 0xC56DB7A9L, 0x252D5705L, 0x8F3719A3L, 0x6F77F90FL,
+        0x4A5AAE0AL, 0xAA1A4EA6L, 0x1B8245B7L, 0xFBC2A51BL, 0xDEEFF21EL, 0x3EAF12B2L,
+        0x94B55C14L, 0x74F5BCB8L, 0x51D8EBBDL, 0xB1980B11L, 0x37048B6EL, 0xD7446BC2L,
+        0xF2693CC7L, 0x1229DC6BL, 0xB83392CDL, 0x58737261L, 0x7D5E2564L, 0x9D1EC5C8L,
+        0x2C86CED9L, 0xCCC62E75L, 0xE9EB7970L, 0x09AB99DCL, 0xA3B1D77AL, 0x43F137D6L,
+        0x66DC60D3L, 0x869C807FL, 0x6E0916DCL, 0x8E49F670L, 0xAB64A175L, 0x4B2441D9L,
+        0xE13E0F7FL, 0x017EEFD3L, 0x2453B8D6L, 0xC413587AL, 0x758B536BL, 0x95CBB3C7L,
+        0xB0E6E4C2L, 0x50A6046EL, 0xFABC4AC8L, 0x1AFCAA64L, 0x3FD1FD61L, 0xDF911DCDL,
+        0x590D9DB2L, 0xB94D7D1EL, 0x9C602A1BL, 0x7C20CAB7L, 0xD63A8411L, 0x367A64BDL,
+        0x135733B8L, 0xF317D314L, 0x428FD805L, 0xA2CF38A9L, 0x87E26FACL, 0x67A28F00L,
+        0xCDB8C1A6L, 0x2DF8210AL, 0x08D5760FL, 0xE89596A3L, 0xDC122DB8L, 0x3C52CD14L,
+        0x197F9A11L, 0xF93F7ABDL, 0x5325341BL, 0xB365D4B7L, 0x964883B2L, 0x7608631EL,
+        0xC790680FL, 0x27D088A3L, 0x02FDDFA6L, 0xE2BD3F0AL, 0x48A771ACL, 0xA8E79100L,
+        0x8DCAC605L, 0x6D8A26A9L, 0xEB16A6D6L, 0x0B56467AL, 0x2E7B117FL, 0xCE3BF1D3L,
+        0x6421BF75L, 0x84615FD9L, 0xA14C08DCL, 0x410CE870L, 0xF094E361L, 0x10D403CDL,
+        0x35F954C8L, 0xD5B9B464L, 0x7FA3FAC2L, 0x9FE31A6EL, 0xBACE4D6BL, 0x5A8EADC7L,
+        0xB21B3B64L, 0x525BDBC8L, 0x77768CCDL, 0x97366C61L, 0x3D2C22C7L, 0xDD6CC26BL,
+        0xF841956EL, 0x180175C2L, 0xA9997ED3L, 0x49D99E7FL, 0x6CF4C97AL, 0x8CB429D6L,
+        0x26AE6770L, 0xC6EE87DCL, 0xE3C3D0D9L, 0x03833075L, 0x851FB00AL, 0x655F50A6L,
+        0x407207A3L, 0xA032E70FL, 0x0A28A9A9L, 0xEA684905L, 0xCF451E00L, 0x2F05FEACL,
+        0x9E9DF5BDL, 0x7EDD1511L, 0x5BF04214L, 0xBBB0A2B8L, 0x11AAEC1EL, 0xF1EA0CB2L,
+        0xD4C75BB7L, 0x3487BB1BL, 0xBDC82D81L, 0x5D88CD2DL, 0x78A59A28L, 0x98E57A84L,
+        0x32FF3422L, 0xD2BFD48EL, 0xF792838BL, 0x17D26327L, 0xA64A6836L, 0x460A889AL,
+        0x6327DF9FL, 0x83673F33L, 0x297D7195L, 0xC93D9139L, 0xEC10C63CL, 0x0C502690L,
+        0x8ACCA6EFL, 0x6A8C4643L, 0x4FA11146L, 0xAFE1F1EAL, 0x05FBBF4CL, 0xE5BB5FE0L,
+        0xC09608E5L, 0x20D6E849L, 0x914EE358L, 0x710E03F4L, 0x542354F1L, 0xB463B45DL,
+        0x1E79FAFBL, 0xFE391A57L, 0xDB144D52L, 0x3B54ADFEL, 0xD3C13B5DL, 0x3381DBF1L,
+        0x16AC8CF4L, 0xF6EC6C58L, 0x5CF622FEL, 0xBCB6C252L, 0x999B9557L, 0x79DB75FBL,
+        0xC8437EEAL, 0x28039E46L, 0x0D2EC943L, 0xED6E29EFL, 0x47746749L, 0xA73487E5L,
+        0x8219D0E0L, 0x6259304CL, 0xE4C5B033L, 0x0485509FL, 0x21A8079AL, 0xC1E8E736L,
+        0x6BF2A990L, 0x8BB2493CL, 0xAE9F1E39L, 0x4EDFFE95L, 0xFF47F584L, 0x1F071528L,
+        0x3A2A422DL, 0xDA6AA281L, 0x7070EC27L, 0x90300C8BL, 0xB51D5B8EL, 0x555DBB22L,
+        0x61DA0039L, 0x819AE095L, 0xA4B7B790L, 0x44F7573CL, 0xEEED199AL, 0x0EADF936L,
+        0x2B80AE33L, 0xCBC04E9FL, 0x7A58458EL, 0x9A18A522L, 0xBF35F227L, 0x5F75128BL,
+        0xF56F5C2DL, 0x152FBC81L, 0x3002EB84L, 0xD0420B28L, 0x56DE8B57L, 0xB69E6BFBL,
+        0x93B33CFEL, 0x73F3DC52L, 0xD9E992F4L, 0x39A97258L, 0x1C84255DL, 0xFCC4C5F1L,
+        0x4D5CCEE0L, 0xAD1C2E4CL, 0x88317949L, 0x687199E5L, 0xC26BD743L, 0x222B37EFL,
+        0x070660EAL, 0xE7468046L, 0x0FD316E5L, 0xEF93F649L, 0xCABEA14CL, 0x2AFE41E0L,
+        0x80E40F46L, 0x60A4EFEAL, 0x4589B8EFL, 0xA5C95843L, 0x14515352L, 0xF411B3FEL,
+        0xD13CE4FBL, 0x317C0457L, 0x9B664AF1L, 0x7B26AA5DL, 0x5E0BFD58L, 0xBE4B1DF4L,
+        0x38D79D8BL, 0xD8977D27L, 0xFDBA2A22L, 0x1DFACA8EL, 0xB7E08428L, 0x57A06484L,
+        0x728D3381L, 0x92CDD32DL, 0x2355D83CL, 0xC3153890L, 0xE6386F95L, 0x06788F39L,
+        0xAC62C19FL, 0x4C222133L, 0x690F7636L, 0x894F969AL
+        },
+        {
+        0x00000000L, 0x7E7C2DF3L, 0xFCF85BE6L, 0x82847615L, 0xFC1CC13DL, 0x8260ECCEL,
+        0x00E49ADBL, 0x7E98B728L, 0xFDD5F48BL, 0x83A9D978L, 0x012DAF6DL, 0x7F51829EL,
+        0x01C935B6L, 0x7FB51845L, 0xFD316E50L, 0x834D43A3L, 0xFE479FE7L, 0x803BB214L,
+        0x02BFC401L, 0x7CC3E9F2L, 0x025B5EDAL, 0x7C277329L, 0xFEA3053CL, 0x80DF28CFL,
+        0x03926B6CL, 0x7DEE469FL, 0xFF6A308AL, 0x81161D79L, 0xFF8EAA51L, 0x81F287A2L,
+        0x0376F1B7L, 0x7D0ADC44L, 0xF963493FL, 0x871F64CCL, 0x059B12D9L, 0x7BE73F2AL,
+        0x057F8802L, 0x7B03A5F1L, 0xF987D3E4L, 0x87FBFE17L, 0x04B6BDB4L, 0x7ACA9047L,
+        0xF84EE652L, 0x8632CBA1L, 0xF8AA7C89L, 0x86D6517AL, 0x0452276FL, 0x7A2E0A9CL,
+        0x0724D6D8L, 0x7958FB2BL, 0xFBDC8D3EL, 0x85A0A0CDL, 0xFB3817E5L, 0x85443A16L,
+        0x07C04C03L, 0x79BC61F0L, 0xFAF12253L, 0x848D0FA0L, 0x060979B5L, 0x78755446L,
+        0x06EDE36EL, 0x7891CE9DL, 0xFA15B888L, 0x8469957BL, 0xF72AE48FL, 0x8956C97CL,
+        0x0BD2BF69L, 0x75AE929AL, 0x0B3625B2L, 0x754A0841L, 0xF7CE7E54L, 0x89B253A7L,
+        0x0AFF1004L, 0x74833DF7L, 0xF6074BE2L, 0x887B6611L, 0xF6E3D139L, 0x889FFCCAL,
+        0x0A1B8ADFL, 0x7467A72CL, 0x096D7B68L, 0x7711569BL, 0xF595208EL, 0x8BE90D7DL,
+        0xF571BA55L, 0x8B0D97A6L, 0x0989E1B3L, 0x77F5CC40L, 0xF4B88FE3L, 0x8AC4A210L,
+        0x0840D405L, 0x763CF9F6L, 0x08A44EDEL, 0x76D8632DL, 0xF45C1538L, 0x8A2038CBL,
+        0x0E49ADB0L, 0x70358043L, 0xF2B1F656L, 0x8CCDDBA5L, 0xF2556C8DL, 0x8C29417EL,
+        0x0EAD376BL, 0x70D11A98L, 0xF39C593BL, 0x8DE074C8L, 0x0F6402DDL, 0x71182F2EL,
+        0x0F809806L, 0x71FCB5F5L, 0xF378C3E0L, 0x8D04EE13L, 0xF00E3257L, 0x8E721FA4L,
+        0x0CF669B1L, 0x728A4442L, 0x0C12F36AL, 0x726EDE99L, 0xF0EAA88CL, 0x8E96857FL,
+        0x0DDBC6DCL, 0x73A7EB2FL, 0xF1239D3AL, 0x8F5FB0C9L, 0xF1C707E1L, 0x8FBB2A12L,
+        0x0D3F5C07L, 0x734371F4L, 0xEBB9BFEFL, 0x95C5921CL, 0x1741E409L, 0x693DC9FAL,
+        0x17A57ED2L, 0x69D95321L, 0xEB5D2534L, 0x952108C7L, 0x166C4B64L, 0x68106697L,
+        0xEA941082L, 0x94E83D71L, 0xEA708A59L, 0x940CA7AAL, 0x1688D1BFL, 0x68F4FC4CL,
+        0x15FE2008L, 0x6B820DFBL, 0xE9067BEEL, 0x977A561DL, 0xE9E2E135L, 0x979ECCC6L,
+        0x151ABAD3L, 0x6B669720L, 0xE82BD483L, 0x9657F970L, 0x14D38F65L, 0x6AAFA296L,
+        0x143715BEL, 0x6A4B384DL, 0xE8CF4E58L, 0x96B363ABL, 0x12DAF6D0L, 0x6CA6DB23L,
+        0xEE22AD36L, 0x905E80C5L, 0xEEC637EDL, 0x90BA1A1EL, 0x123E6C0BL, 0x6C4241F8L,
+        0xEF0F025BL, 0x91732FA8L, 0x13F759BDL, 0x6D8B744EL, 0x1313C366L, 0x6D6FEE95L,
+        0xEFEB9880L, 0x9197B573L, 0xEC9D6937L, 0x92E144C4L, 0x106532D1L, 0x6E191F22L,
+        0x1081A80AL, 0x6EFD85F9L, 0xEC79F3ECL, 0x9205DE1FL, 0x11489DBCL, 0x6F34B04FL,
+        0xEDB0C65AL, 0x93CCEBA9L, 0xED545C81L, 0x93287172L, 0x11AC0767L, 0x6FD02A94L,
+        0x1C935B60L, 0x62EF7693L, 0xE06B0086L, 0x9E172D75L, 0xE08F9A5DL, 0x9EF3B7AEL,
+        0x1C77C1BBL, 0x620BEC48L, 0xE146AFEBL, 0x9F3A8218L, 0x1DBEF40DL, 0x63C2D9FEL,
+        0x1D5A6ED6L, 0x63264325L, 0xE1A23530L, 0x9FDE18C3L, 0xE2D4C487L, 0x9CA8E974L,
+        0x1E2C9F61L, 0x6050B292L, 0x1EC805BAL, 0x60B42849L, 0xE2305E5CL, 0x9C4C73AFL,
+        0x1F01300CL, 0x617D1DFFL, 0xE3F96BEAL, 0x9D854619L, 0xE31DF131L, 0x9D61DCC2L,
+        0x1FE5AAD7L, 0x61998724L, 0xE5F0125FL, 0x9B8C3FACL, 0x190849B9L, 0x6774644AL,
+        0x19ECD362L, 0x6790FE91L, 0xE5148884L, 0x9B68A577L, 0x1825E6D4L, 0x6659CB27L,
+        0xE4DDBD32L, 0x9AA190C1L, 0xE43927E9L, 0x9A450A1AL, 0x18C17C0FL, 0x66BD51FCL,
+        0x1BB78DB8L, 0x65CBA04BL, 0xE74FD65EL, 0x9933FBADL, 0xE7AB4C85L, 0x99D76176L,
+        0x1B531763L, 0x652F3A90L, 0xE6627933L, 0x981E54C0L, 0x1A9A22D5L, 0x64E60F26L,
+        0x1A7EB80EL, 0x640295FDL, 0xE686E3E8L, 0x98FACE1BL
+        },
+        {
+        0x00000000L, 0xD29F092FL, 0xA0D264AFL, 0x724D6D80L, 0x4448BFAFL, 0x96D7B680L,
+        0xE49ADB00L, 0x3605D22FL, 0x88917F5EL, 0x5A0E7671L, 0x28431BF1L, 0xFADC12DEL,
+        0xCCD9C0F1L, 0x1E46C9DEL, 0x6C0BA45EL, 0xBE94AD71L, 0x14CE884DL, 0xC6518162L,
+        0xB41CECE2L, 0x6683E5CDL, 0x508637E2L, 0x82193ECDL, 0xF054534DL, 0x22CB5A62L,
+        0x9C5FF713L, 0x4EC0FE3CL, 0x3C8D93BCL, 0xEE129A93L, 0xD81748BCL, 0x0A884193L,
+        0x78C52C13L, 0xAA5A253CL, 0x299D109AL, 0xFB0219B5L, 0x894F7435L, 0x5BD07D1AL,
+        0x6DD5AF35L, 0xBF4AA61AL, 0xCD07CB9AL, 0x1F98C2B5L, 0xA10C6FC4L, 0x739366EBL,
+        0x01DE0B6BL, 0xD3410244L, 0xE544D06BL, 0x37DBD944L, 0x4596B4C4L, 0x9709BDEBL,
+        0x3D5398D7L, 0xEFCC91F8L, 0x9D81FC78L, 0x4F1EF557L, 0x791B2778L, 0xAB842E57L,
+        0xD9C943D7L, 0x0B564AF8L, 0xB5C2E789L, 0x675DEEA6L, 0x15108326L, 0xC78F8A09L,
+        0xF18A5826L, 0x23155109L, 0x51583C89L, 0x83C735A6L, 0x533A2134L, 0x81A5281BL,
+        0xF3E8459BL, 0x21774CB4L, 0x17729E9BL, 0xC5ED97B4L, 0xB7A0FA34L, 0x653FF31BL,
+        0xDBAB5E6AL, 0x09345745L, 0x7B793AC5L, 0xA9E633EAL, 0x9FE3E1C5L, 0x4D7CE8EAL,
+        0x3F31856AL, 0xEDAE8C45L, 0x47F4A979L, 0x956BA056L, 0xE726CDD6L, 0x35B9C4F9L,
+        0x03BC16D6L, 0xD1231FF9L, 0xA36E7279L, 0x71F17B56L, 0xCF65D627L, 0x1DFADF08L,
+        0x6FB7B288L, 0xBD28BBA7L, 0x8B2D6988L, 0x59B260A7L, 0x2BFF0D27L, 0xF9600408L,
+        0x7AA731AEL, 0xA8383881L, 0xDA755501L, 0x08EA5C2EL, 0x3EEF8E01L, 0xEC70872EL,
+        0x9E3DEAAEL, 0x4CA2E381L, 0xF2364EF0L, 0x20A947DFL, 0x52E42A5FL, 0x807B2370L,
+        0xB67EF15FL, 0x64E1F870L, 0x16AC95F0L, 0xC4339CDFL, 0x6E69B9E3L, 0xBCF6B0CCL,
+        0xCEBBDD4CL, 0x1C24D463L, 0x2A21064CL, 0xF8BE0F63L, 0x8AF362E3L, 0x586C6BCCL,
+        0xE6F8C6BDL, 0x3467CF92L, 0x462AA212L, 0x94B5AB3DL, 0xA2B07912L, 0x702F703DL,
+        0x02621DBDL, 0xD0FD1492L, 0xA6744268L, 0x74EB4B47L, 0x06A626C7L, 0xD4392FE8L,
+        0xE23CFDC7L, 0x30A3F4E8L, 0x42EE9968L, 0x90719047L, 0x2EE53D36L, 0xFC7A3419L,
+        0x8E375999L, 0x5CA850B6L, 0x6AAD8299L, 0xB8328BB6L, 0xCA7FE636L, 0x18E0EF19L,
+        0xB2BACA25L, 0x6025C30AL, 0x1268AE8AL, 0xC0F7A7A5L, 0xF6F2758AL, 0x246D7CA5L,
+        0x56201125L, 0x84BF180AL, 0x3A2BB57BL, 0xE8B4BC54L, 0x9AF9D1D4L, 0x4866D8FBL,
+        0x7E630AD4L, 0xACFC03FBL, 0xDEB16E7BL, 0x0C2E6754L, 0x8FE952F2L, 0x5D765BDDL,
+        0x2F3B365DL, 0xFDA43F72L, 0xCBA1ED5DL, 0x193EE472L, 0x6B7389F2L, 0xB9EC80DDL,
+        0x07782DACL, 0xD5E72483L, 0xA7AA4903L, 0x7535402CL, 0x43309203L, 0x91AF9B2CL,
+        0xE3E2F6ACL, 0x317DFF83L, 0x9B27DABFL, 0x49B8D390L, 0x3BF5BE10L, 0xE96AB73FL,
+        0xDF6F6510L, 0x0DF06C3FL, 0x7FBD01BFL, 0xAD220890L, 0x13B6A5E1L, 0xC129ACCEL,
+        0xB364C14EL, 0x61FBC861L, 0x57FE1A4EL, 0x85611361L, 0xF72C7EE1L, 0x25B377CEL,
+        0xF54E635CL, 0x27D16A73L, 0x559C07F3L, 0x87030EDCL, 0xB106DCF3L, 0x6399D5DCL,
+        0x11D4B85CL, 0xC34BB173L, 0x7DDF1C02L, 0xAF40152DL, 0xDD0D78ADL, 0x0F927182L,
+        0x3997A3ADL, 0xEB08AA82L, 0x9945C702L, 0x4BDACE2DL, 0xE180EB11L, 0x331FE23EL,
+        0x41528FBEL, 0x93CD8691L, 0xA5C854BEL, 0x77575D91L, 0x051A3011L, 0xD785393EL,
+        0x6911944FL, 0xBB8E9D60L, 0xC9C3F0E0L, 0x1B5CF9CFL, 0x2D592BE0L, 0xFFC622CFL,
+        0x8D8B4F4FL, 0x5F144660L, 0xDCD373C6L, 0x0E4C7AE9L, 0x7C011769L, 0xAE9E1E46L,
+        0x989BCC69L, 0x4A04C546L, 0x3849A8C6L, 0xEAD6A1E9L, 0x54420C98L, 0x86DD05B7L,
+        0xF4906837L, 0x260F6118L, 0x100AB337L, 0xC295BA18L, 0xB0D8D798L, 0x6247DEB7L,
+        0xC81DFB8BL, 0x1A82F2A4L, 0x68CF9F24L, 0xBA50960BL, 0x8C554424L, 0x5ECA4D0BL,
+        0x2C87208BL, 0xFE1829A4L, 0x408C84D5L, 0x92138DFAL, 0xE05EE07AL, 0x32C1E955L,
+        0x04C43B7AL, 0xD65B3255L, 0xA4165FD5L, 0x768956FAL
+        },
+        {
+        0x00000000L, 0x4904F221L, 0x9209E442L, 0xDB0D1663L, 0x21FFBE75L, 0x68FB4C54L,
+        0xB3F65A37L, 0xFAF2A816L, 0x43FF7CEAL, 0x0AFB8ECBL, 0xD1F698A8L, 0x98F26A89L,
+        0x6200C29FL, 0x2B0430BEL, 0xF00926DDL, 0xB90DD4FCL, 0x87FEF9D4L, 0xCEFA0BF5L,
+        0x15F71D96L, 0x5CF3EFB7L, 0xA60147A1L, 0xEF05B580L, 0x3408A3E3L, 0x7D0C51C2L,
+        0xC401853EL, 0x8D05771FL, 0x5608617CL, 0x1F0C935DL, 0xE5FE3B4BL, 0xACFAC96AL,
+        0x77F7DF09L, 0x3EF32D28L, 0x0A118559L, 0x43157778L, 0x9818611BL, 0xD11C933AL,
+        0x2BEE3B2CL, 0x62EAC90DL, 0xB9E7DF6EL, 0xF0E32D4FL, 0x49EEF9B3L, 0x00EA0B92L,
+        0xDBE71DF1L, 0x92E3EFD0L, 0x681147C6L, 0x2115B5E7L, 0xFA18A384L, 0xB31C51A5L,
+        0x8DEF7C8DL, 0xC4EB8EACL, 0x1FE698CFL, 0x56E26AEEL, 0xAC10C2F8L, 0xE51430D9L,
+        0x3E1926BAL, 0x771DD49BL, 0xCE100067L, 0x8714F246L, 0x5C19E425L, 0x151D1604L,
+        0xEFEFBE12L, 0xA6EB4C33L, 0x7DE65A50L, 0x34E2A871L, 0x14230AB2L, 0x5D27F893L,
+        0x862AEEF0L, 0xCF2E1CD1L, 0x35DCB4C7L, 0x7CD846E6L, 0xA7D55085L, 0xEED1A2A4L,
+        0x57DC7658L, 0x1ED88479L, 0xC5D5921AL, 0x8CD1603BL, 0x7623C82DL, 0x3F273A0CL,
+        0xE42A2C6FL, 0xAD2EDE4EL, 0x93DDF366L, 0xDAD90147L, 0x01D41724L, 0x48D0E505L,
+        0xB2224D13L, 0xFB26BF32L, 0x202BA951L, 0x692F5B70L, 0xD0228F8CL, 0x99267DADL,
+        0x422B6BCEL, 0x0B2F99EFL, 0xF1DD31F9L, 0xB8D9C3D8L, 0x63D4D5BBL, 0x2AD0279AL,
+        0x1E328FEBL, 0x57367DCAL, 0x8C3B6BA9L, 0xC53F9988L, 0x3FCD319EL, 0x76C9C3BFL,
+        0xADC4D5DCL, 0xE4C027FDL, 0x5DCDF301L, 0x14C90120L, 0xCFC41743L, 0x86C0E562L,
+        0x7C324D74L, 0x3536BF55L, 0xEE3BA936L, 0xA73F5B17L, 0x99CC763FL, 0xD0C8841EL,
+        0x0BC5927DL, 0x42C1605CL, 0xB833C84AL, 0xF1373A6BL, 0x2A3A2C08L, 0x633EDE29L,
+        0xDA330AD5L, 0x9337F8F4L, 0x483AEE97L, 0x013E1CB6L, 0xFBCCB4A0L, 0xB2C84681L,
+        0x69C550E2L, 0x20C1A2C3L, 0x28461564L, 0x6142E745L, 0xBA4FF126L, 0xF34B0307L,
+        0x09B9AB11L, 0x40BD5930L, 0x9BB04F53L, 0xD2B4BD72L, 0x6BB9698EL, 0x22BD9BAFL,
+        0xF9B08DCCL, 0xB0B47FEDL, 0x4A46D7FBL, 0x034225DAL, 0xD84F33B9L, 0x914BC198L,
+        0xAFB8ECB0L, 0xE6BC1E91L, 0x3DB108F2L, 0x74B5FAD3L, 0x8E4752C5L, 0xC743A0E4L,
+        0x1C4EB687L, 0x554A44A6L, 0xEC47905AL, 0xA543627BL, 0x7E4E7418L, 0x374A8639L,
+        0xCDB82E2FL, 0x84BCDC0EL, 0x5FB1CA6DL, 0x16B5384CL, 0x2257903DL, 0x6B53621CL,
+        0xB05E747FL, 0xF95A865EL, 0x03A82E48L, 0x4AACDC69L, 0x91A1CA0AL, 0xD8A5382BL,
+        0x61A8ECD7L, 0x28AC1EF6L, 0xF3A10895L, 0xBAA5FAB4L, 0x405752A2L, 0x0953A083L,
+        0xD25EB6E0L, 0x9B5A44C1L, 0xA5A969E9L, 0xECAD9BC8L, 0x37A08DABL, 0x7EA47F8AL,
+        0x8456D79CL, 0xCD5225BDL, 0x165F33DEL, 0x5F5BC1FFL, 0xE6561503L, 0xAF52E722L,
+        0x745FF141L, 0x3D5B0360L, 0xC7A9AB76L, 0x8EAD5957L, 0x55A04F34L, 0x1CA4BD15L,
+        0x3C651FD6L, 0x7561EDF7L, 0xAE6CFB94L, 0xE76809B5L, 0x1D9AA1A3L, 0x549E5382L,
+        0x8F9345E1L, 0xC697B7C0L, 0x7F9A633CL, 0x369E911DL, 0xED93877EL, 0xA497755FL,
+        0x5E65DD49L, 0x17612F68L, 0xCC6C390BL, 0x8568CB2AL, 0xBB9BE602L, 0xF29F1423L,
+        0x29920240L, 0x6096F061L, 0x9A645877L, 0xD360AA56L, 0x086DBC35L, 0x41694E14L,
+        0xF8649AE8L, 0xB16068C9L, 0x6A6D7EAAL, 0x23698C8BL, 0xD99B249DL, 0x909FD6BCL,
+        0x4B92C0DFL, 0x029632FEL, 0x36749A8FL, 0x7F7068AEL, 0xA47D7ECDL, 0xED798CECL,
+        0x178B24FAL, 0x5E8FD6DBL, 0x8582C0B8L, 0xCC863299L, 0x758BE665L, 0x3C8F1444L,
+        0xE7820227L, 0xAE86F006L, 0x54745810L, 0x1D70AA31L, 0xC67DBC52L, 0x8F794E73L,
+        0xB18A635BL, 0xF88E917AL, 0x23838719L, 0x6A877538L, 0x9075DD2EL, 0xD9712F0FL,
+        0x027C396CL, 0x4B78CB4DL, 0xF2751FB1L, 0xBB71ED90L, 0x607CFBF3L, 0x297809D2L,
+        0xD38AA1C4L, 0x9A8E53E5L, 0x41834586L, 0x0887B7A7L
+        }
+    };
+
+static const uint32_t crc32c_short[4][256] =
+    {
+        {
+        0x00000000L, 0xDCB17AA4L, 0xBC8E83B9L, 0x603FF91DL, 0x7CF17183L, 0xA0400B27L,
+        0xC07FF23AL, 0x1CCE889EL, 0xF9E2E306L, 0x255399A2L, 0x456C60BFL, 0x99DD1A1BL,
+        0x85139285L, 0x59A2E821L, 0x399D113CL, 0xE52C6B98L, 0xF629B0FDL, 0x2A98CA59L,
+        0x4AA73344L, 0x961649E0L, 0x8AD8C17EL, 0x5669BBDAL, 0x365642C7L, 0xEAE73863L,
+        0x0FCB53FBL, 0xD37A295FL, 0xB345D042L, 0x6FF4AAE6L, 0x733A2278L, 0xAF8B58DCL,
+        0xCFB4A1C1L, 0x1305DB65L, 0xE9BF170BL, 0x350E6DAFL, 0x553194B2L, 0x8980EE16L,
+        0x954E6688L, 0x49FF1C2CL, 0x29C0E531L, 0xF5719F95L, 0x105DF40DL, 0xCCEC8EA9L,
+        0xACD377B4L, 0x70620D10L, 0x6CAC858EL, 0xB01DFF2AL, 0xD0220637L, 0x0C937C93L,
+        0x1F96A7F6L, 0xC327DD52L, 0xA318244FL, 0x7FA95EEBL, 0x6367D675L, 0xBFD6ACD1L,
+        0xDFE955CCL, 0x03582F68L, 0xE67444F0L, 0x3AC53E54L, 0x5AFAC749L, 0x864BBDEDL,
+        0x9A853573L, 0x46344FD7L, 0x260BB6CAL, 0xFABACC6EL, 0xD69258E7L, 0x0A232243L,
+        0x6A1CDB5EL, 0xB6ADA1FAL, 0xAA632964L, 0x76D253C0L, 0x16EDAADDL, 0xCA5CD079L,
+        0x2F70BBE1L, 0xF3C1C145L, 0x93FE3858L, 0x4F4F42FCL, 0x5381CA62L, 0x8F30B0C6L,
+        0xEF0F49DBL, 0x33BE337FL, 0x20BBE81AL, 0xFC0A92BEL, 0x9C356BA3L, 0x40841107L,
+        0x5C4A9999L, 0x80FBE33DL, 0xE0C41A20L, 0x3C756084L, 0xD9590B1CL, 0x05E871B8L,
+        0x65D788A5L, 0xB966F201L, 0xA5A87A9FL, 0x7919003BL, 0x1926F926L, 0xC5978382L,
+        0x3F2D4FECL, 0xE39C3548L, 0x83A3CC55L, 0x5F12B6F1L, 0x43DC3E6FL, 0x9F6D44CBL,
+        0xFF52BDD6L, 0x23E3C772L, 0xC6CFACEAL, 0x1A7ED64EL, 0x7A412F53L, 0xA6F055F7L,
+        0xBA3EDD69L, 0x668FA7CDL, 0x06B05ED0L, 0xDA012474L, 0xC904FF11L, 0x15B585B5L,
+        0x758A7CA8L, 0xA93B060CL, 0xB5F58E92L, 0x6944F436L, 0x097B0D2BL, 0xD5CA778FL,
+        0x30E61C17L, 0xEC5766B3L, 0x8C689FAEL, 0x50D9E50AL, 0x4C176D94L, 0x90A61730L,
+        0xF099EE2DL, 0x2C289489L, 0xA8C8C73FL, 0x7479BD9BL, 0x14464486L, 0xC8F73E22L,
+        0xD439B6BCL, 0x0888CC18L, 0x68B73505L, 0xB4064FA1L, 0x512A2439L, 0x8D9B5E9DL,
+        0xEDA4A780L, 0x3115DD24L, 0x2DDB55BAL, 0xF16A2F1EL, 0x9155D603L, 0x4DE4ACA7L,
+        0x5EE177C2L, 0x82500D66L, 0xE26FF47BL, 0x3EDE8EDFL, 0x22100641L, 0xFEA17CE5L,
+        0x9E9E85F8L, 0x422FFF5CL, 0xA70394C4L, 0x7BB2EE60L, 0x1B8D177DL, 0xC73C6DD9L,
+        0xDBF2E547L, 0x07439FE3L, 0x677C66FEL, 0xBBCD1C5AL, 0x4177D034L, 0x9DC6AA90L,
+        0xFDF9538DL, 0x21482929L, 0x3D86A1B7L, 0xE137DB13L, 0x8108220EL, 0x5DB958AAL,
+        0xB8953332L, 0x64244996L, 0x041BB08BL, 0xD8AACA2FL, 0xC46442B1L, 0x18D53815L,
+        0x78EAC108L, 0xA45BBBACL, 0xB75E60C9L, 0x6BEF1A6DL, 0x0BD0E370L, 0xD76199D4L,
+        0xCBAF114AL, 0x171E6BEEL, 0x772192F3L, 0xAB90E857L, 0x4EBC83CFL, 0x920DF96BL,
+        0xF2320076L, 0x2E837AD2L, 0x324DF24CL, 0xEEFC88E8L, 0x8EC371F5L, 0x52720B51L,
+        0x7E5A9FD8L, 0xA2EBE57CL, 0xC2D41C61L, 0x1E6566C5L, 0x02ABEE5BL, 0xDE1A94FFL,
+        0xBE256DE2L, 0x62941746L, 0x87B87CDEL, 0x5B09067AL, 0x3B36FF67L, 0xE78785C3L,
+        0xFB490D5DL, 0x27F877F9L, 0x47C78EE4L, 0x9B76F440L, 0x88732F25L, 0x54C25581L,
+        0x34FDAC9CL, 0xE84CD638L, 0xF4825EA6L, 0x28332402L, 0x480CDD1FL, 0x94BDA7BBL,
+        0x7191CC23L, 0xAD20B687L, 0xCD1F4F9AL, 0x11AE353EL, 0x0D60BDA0L, 0xD1D1C704L,
+        0xB1EE3E19L, 0x6D5F44BDL, 0x97E588D3L, 0x4B54F277L, 0x2B6B0B6AL, 0xF7DA71CEL,
+        0xEB14F950L, 0x37A583F4L, 0x579A7AE9L, 0x8B2B004DL, 0x6E076BD5L, 0xB2B61171L,
+        0xD289E86CL, 0x0E3892C8L, 0x12F61A56L, 0xCE4760F2L, 0xAE7899EFL, 0x72C9E34BL,
+        0x61CC382EL, 0xBD7D428AL, 0xDD42BB97L, 0x01F3C133L, 0x1D3D49ADL, 0xC18C3309L,
+        0xA1B3CA14L, 0x7D02B0B0L, 0x982EDB28L, 0x449FA18CL, 0x24A05891L, 0xF8112235L,
+        0xE4DFAAABL, 0x386ED00FL, 0x58512912L, 0x84E053B6L
+        },
+        {
+        0x00000000L, 0x547DF88FL, 0xA8FBF11EL, 0xFC860991L, 0x541B94CDL, 0x00666C42L,
+        0xFCE065D3L, 0xA89D9D5CL, 0xA837299AL, 0xFC4AD115L, 0x00CCD884L, 0x54B1200BL,
+        0xFC2CBD57L, 0xA85145D8L, 0x54D74C49L, 0x00AAB4C6L, 0x558225C5L, 0x01FFDD4AL,
+        0xFD79D4DBL, 0xA9042C54L, 0x0199B108L, 0x55E44987L, 0xA9624016L, 0xFD1FB899L,
+        0xFDB50C5FL, 0xA9C8F4D0L, 0x554EFD41L, 0x013305CEL, 0xA9AE9892L, 0xFDD3601DL,
+        0x0155698CL, 0x55289103L, 0xAB044B8AL, 0xFF79B305L, 0x03FFBA94L, 0x5782421BL,
+        0xFF1FDF47L, 0xAB6227C8L, 0x57E42E59L, 0x0399D6D6L, 0x03336210L, 0x574E9A9FL,
+        0xABC8930EL, 0xFFB56B81L, 0x5728F6DDL, 0x03550E52L, 0xFFD307C3L, 0xABAEFF4CL,
+        0xFE866E4FL, 0xAAFB96C0L, 0x567D9F51L, 0x020067DEL, 0xAA9DFA82L, 0xFEE0020DL,
+        0x02660B9CL, 0x561BF313L, 0x56B147D5L, 0x02CCBF5AL, 0xFE4AB6CBL, 0xAA374E44L,
+        0x02AAD318L, 0x56D72B97L, 0xAA512206L, 0xFE2CDA89L, 0x53E4E1E5L, 0x0799196AL,
+        0xFB1F10FBL, 0xAF62E874L, 0x07FF7528L, 0x53828DA7L, 0xAF048436L, 0xFB797CB9L,
+        0xFBD3C87FL, 0xAFAE30F0L, 0x53283961L, 0x0755C1EEL, 0xAFC85CB2L, 0xFBB5A43DL,
+        0x0733ADACL, 0x534E5523L, 0x0666C420L, 0x521B3CAFL, 0xAE9D353EL, 0xFAE0CDB1L,
+        0x527D50EDL, 0x0600A862L, 0xFA86A1F3L, 0xAEFB597CL, 0xAE51EDBAL, 0xFA2C1535L,
+        0x06AA1CA4L, 0x52D7E42BL, 0xFA4A7977L, 0xAE3781F8L, 0x52B18869L, 0x06CC70E6L,
+        0xF8E0AA6FL, 0xAC9D52E0L, 0x501B5B71L, 0x0466A3FEL, 0xACFB3EA2L, 0xF886C62DL,
+        0x0400CFBCL, 0x507D3733L, 0x50D783F5L, 0x04AA7B7AL, 0xF82C72EBL, 0xAC518A64L,
+        0x04CC1738L, 0x50B1EFB7L, 0xAC37E626L, 0xF84A1EA9L, 0xAD628FAAL, 0xF91F7725L,
+        0x05997EB4L, 0x51E4863BL, 0xF9791B67L, 0xAD04E3E8L, 0x5182EA79L, 0x05FF12F6L,
+        0x0555A630L, 0x51285EBFL, 0xADAE572EL, 0xF9D3AFA1L, 0x514E32FDL, 0x0533CA72L,
+        0xF9B5C3E3L, 0xADC83B6CL, 0xA7C9C3CAL, 0xF3B43B45L, 0x0F3232D4L, 0x5B4FCA5BL,
+        0xF3D25707L, 0xA7AFAF88L, 0x5B29A619L, 0x0F545E96L, 0x0FFEEA50L, 0x5B8312DFL,
+        0xA7051B4EL, 0xF378E3C1L, 0x5BE57E9DL, 0x0F988612L, 0xF31E8F83L, 0xA763770CL,
+        0xF24BE60FL, 0xA6361E80L, 0x5AB01711L, 0x0ECDEF9EL, 0xA65072C2L, 0xF22D8A4DL,
+        0x0EAB83DCL, 0x5AD67B53L, 0x5A7CCF95L, 0x0E01371AL, 0xF2873E8BL, 0xA6FAC604L,
+        0x0E675B58L, 0x5A1AA3D7L, 0xA69CAA46L, 0xF2E152C9L, 0x0CCD8840L, 0x58B070CFL,
+        0xA436795EL, 0xF04B81D1L, 0x58D61C8DL, 0x0CABE402L, 0xF02DED93L, 0xA450151CL,
+        0xA4FAA1DAL, 0xF0875955L, 0x0C0150C4L, 0x587CA84BL, 0xF0E13517L, 0xA49CCD98L,
+        0x581AC409L, 0x0C673C86L, 0x594FAD85L, 0x0D32550AL, 0xF1B45C9BL, 0xA5C9A414L,
+        0x0D543948L, 0x5929C1C7L, 0xA5AFC856L, 0xF1D230D9L, 0xF178841FL, 0xA5057C90L,
+        0x59837501L, 0x0DFE8D8EL, 0xA56310D2L, 0xF11EE85DL, 0x0D98E1CCL, 0x59E51943L,
+        0xF42D222FL, 0xA050DAA0L, 0x5CD6D331L, 0x08AB2BBEL, 0xA036B6E2L, 0xF44B4E6DL,
+        0x08CD47FCL, 0x5CB0BF73L, 0x5C1A0BB5L, 0x0867F33AL, 0xF4E1FAABL, 0xA09C0224L,
+        0x08019F78L, 0x5C7C67F7L, 0xA0FA6E66L, 0xF48796E9L, 0xA1AF07EAL, 0xF5D2FF65L,
+        0x0954F6F4L, 0x5D290E7BL, 0xF5B49327L, 0xA1C96BA8L, 0x5D4F6239L, 0x09329AB6L,
+        0x09982E70L, 0x5DE5D6FFL, 0xA163DF6EL, 0xF51E27E1L, 0x5D83BABDL, 0x09FE4232L,
+        0xF5784BA3L, 0xA105B32CL, 0x5F2969A5L, 0x0B54912AL, 0xF7D298BBL, 0xA3AF6034L,
+        0x0B32FD68L, 0x5F4F05E7L, 0xA3C90C76L, 0xF7B4F4F9L, 0xF71E403FL, 0xA363B8B0L,
+        0x5FE5B121L, 0x0B9849AEL, 0xA305D4F2L, 0xF7782C7DL, 0x0BFE25ECL, 0x5F83DD63L,
+        0x0AAB4C60L, 0x5ED6B4EFL, 0xA250BD7EL, 0xF62D45F1L, 0x5EB0D8ADL, 0x0ACD2022L,
+        0xF64B29B3L, 0xA236D13CL, 0xA29C65FAL, 0xF6E19D75L, 0x0A6794E4L, 0x5E1A6C6BL,
+        0xF687F137L, 0xA2FA09B8L, 0x5E7C0029L, 0x0A01F8A6L
+        },
+        {
+        0x00000000L, 0x4A7FF165L, 0x94FFE2CAL, 0xDE8013AFL, 0x2C13B365L, 0x666C4200L,
+        0xB8EC51AFL, 0xF293A0CAL, 0x582766CAL, 0x125897AFL, 0xCCD88400L, 0x86A77565L,
+        0x7434D5AFL, 0x3E4B24CAL, 0xE0CB3765L, 0xAAB4C600L, 0xB04ECD94L, 0xFA313CF1L,
+        0x24B12F5EL, 0x6ECEDE3BL, 0x9C5D7EF1L, 0xD6228F94L, 0x08A29C3BL, 0x42DD6D5EL,
+        0xE869AB5EL, 0xA2165A3BL, 0x7C964994L, 0x36E9B8F1L, 0xC47A183BL, 0x8E05E95EL,
+        0x5085FAF1L, 0x1AFA0B94L, 0x6571EDD9L, 0x2F0E1CBCL, 0xF18E0F13L, 0xBBF1FE76L,
+        0x49625EBCL, 0x031DAFD9L, 0xDD9DBC76L, 0x97E24D13L, 0x3D568B13L, 0x77297A76L,
+        0xA9A969D9L, 0xE3D698BCL, 0x11453876L, 0x5B3AC913L, 0x85BADABCL, 0xCFC52BD9L,
+        0xD53F204DL, 0x9F40D128L, 0x41C0C287L, 0x0BBF33E2L, 0xF92C9328L, 0xB353624DL,
+        0x6DD371E2L, 0x27AC8087L, 0x8D184687L, 0xC767B7E2L, 0x19E7A44DL, 0x53985528L,
+        0xA10BF5E2L, 0xEB740487L, 0x35F41728L, 0x7F8BE64DL, 0xCAE3DBB2L, 0x809C2AD7L,
+        0x5E1C3978L, 0x1463C81DL, 0xE6F068D7L, 0xAC8F99B2L, 0x720F8A1DL, 0x38707B78L,
+        0x92C4BD78L, 0xD8BB4C1DL, 0x063B5FB2L, 0x4C44AED7L, 0xBED70E1DL, 0xF4A8FF78L,
+        0x2A28ECD7L, 0x60571DB2L, 0x7AAD1626L, 0x30D2E743L, 0xEE52F4ECL, 0xA42D0589L,
+        0x56BEA543L, 0x1CC15426L, 0xC2414789L, 0x883EB6ECL, 0x228A70ECL, 0x68F58189L,
+        0xB6759226L, 0xFC0A6343L, 0x0E99C389L, 0x44E632ECL, 0x9A662143L, 0xD019D026L,
+        0xAF92366BL, 0xE5EDC70EL, 0x3B6DD4A1L, 0x711225C4L, 0x8381850EL, 0xC9FE746BL,
+        0x177E67C4L, 0x5D0196A1L, 0xF7B550A1L, 0xBDCAA1C4L, 0x634AB26BL, 0x2935430EL,
+        0xDBA6E3C4L, 0x91D912A1L, 0x4F59010EL, 0x0526F06BL, 0x1FDCFBFFL, 0x55A30A9AL,
+        0x8B231935L, 0xC15CE850L, 0x33CF489AL, 0x79B0B9FFL, 0xA730AA50L, 0xED4F5B35L,
+        0x47FB9D35L, 0x0D846C50L, 0xD3047FFFL, 0x997B8E9AL, 0x6BE82E50L, 0x2197DF35L,
+        0xFF17CC9AL, 0xB5683DFFL, 0x902BC195L, 0xDA5430F0L, 0x04D4235FL, 0x4EABD23AL,
+        0xBC3872F0L, 0xF6478395L, 0x28C7903AL, 0x62B8615FL, 0xC80CA75FL, 0x8273563AL,
+        0x5CF34595L, 0x168CB4F0L, 0xE41F143AL, 0xAE60E55FL, 0x70E0F6F0L, 0x3A9F0795L,
+        0x20650C01L, 0x6A1AFD64L, 0xB49AEECBL, 0xFEE51FAEL, 0x0C76BF64L, 0x46094E01L,
+        0x98895DAEL, 0xD2F6ACCBL, 0x78426ACBL, 0x323D9BAEL, 0xECBD8801L, 0xA6C27964L,
+        0x5451D9AEL, 0x1E2E28CBL, 0xC0AE3B64L, 0x8AD1CA01L, 0xF55A2C4CL, 0xBF25DD29L,
+        0x61A5CE86L, 0x2BDA3FE3L, 0xD9499F29L, 0x93366E4CL, 0x4DB67DE3L, 0x07C98C86L,
+        0xAD7D4A86L, 0xE702BBE3L, 0x3982A84CL, 0x73FD5929L, 0x816EF9E3L, 0xCB110886L,
+        0x15911B29L, 0x5FEEEA4CL, 0x4514E1D8L, 0x0F6B10BDL, 0xD1EB0312L, 0x9B94F277L,
+        0x690752BDL, 0x2378A3D8L, 0xFDF8B077L, 0xB7874112L, 0x1D338712L, 0x574C7677L,
+        0x89CC65D8L, 0xC3B394BDL, 0x31203477L, 0x7B5FC512L, 0xA5DFD6BDL, 0xEFA027D8L,
+        0x5AC81A27L, 0x10B7EB42L, 0xCE37F8EDL, 0x84480988L, 0x76DBA942L, 0x3CA45827L,
+        0xE2244B88L, 0xA85BBAEDL, 0x02EF7CEDL, 0x48908D88L, 0x96109E27L, 0xDC6F6F42L,
+        0x2EFCCF88L, 0x64833EEDL, 0xBA032D42L, 0xF07CDC27L, 0xEA86D7B3L, 0xA0F926D6L,
+        0x7E793579L, 0x3406C41CL, 0xC69564D6L, 0x8CEA95B3L, 0x526A861CL, 0x18157779L,
+        0xB2A1B179L, 0xF8DE401CL, 0x265E53B3L, 0x6C21A2D6L, 0x9EB2021CL, 0xD4CDF379L,
+        0x0A4DE0D6L, 0x403211B3L, 0x3FB9F7FEL, 0x75C6069BL, 0xAB461534L, 0xE139E451L,
+        0x13AA449BL, 0x59D5B5FEL, 0x8755A651L, 0xCD2A5734L, 0x679E9134L, 0x2DE16051L,
+        0xF36173FEL, 0xB91E829BL, 0x4B8D2251L, 0x01F2D334L, 0xDF72C09BL, 0x950D31FEL,
+        0x8FF73A6AL, 0xC588CB0FL, 0x1B08D8A0L, 0x517729C5L, 0xA3E4890FL, 0xE99B786AL,
+        0x371B6BC5L, 0x7D649AA0L, 0xD7D05CA0L, 0x9DAFADC5L, 0x432FBE6AL, 0x09504F0FL,
+        0xFBC3EFC5L, 0xB1BC1EA0L, 0x6F3C0D0FL, 0x2543FC6AL
+        },
+        {
+        0x00000000L, 0x25BBF5DBL, 0x4B77EBB6L, 0x6ECC1E6DL, 0x96EFD76CL, 0xB35422B7L,
+        0xDD983CDAL, 0xF823C901L, 0x2833D829L, 0x0D882DF2L, 0x6344339FL, 0x46FFC644L,
+        0xBEDC0F45L, 0x9B67FA9EL, 0xF5ABE4F3L, 0xD0101128L, 0x5067B052L, 0x75DC4589L,
+        0x1B105BE4L, 0x3EABAE3FL, 0xC688673EL, 0xE33392E5L, 0x8DFF8C88L, 0xA8447953L,
+        0x7854687BL, 0x5DEF9DA0L, 0x332383CDL, 0x16987616L, 0xEEBBBF17L, 0xCB004ACCL,
+        0xA5CC54A1L, 0x8077A17AL, 0xA0CF60A4L, 0x8574957FL, 0xEBB88B12L, 0xCE037EC9L,
+        0x3620B7C8L, 0x139B4213L, 0x7D575C7EL, 0x58ECA9A5L, 0x88FCB88DL, 0xAD474D56L,
+        0xC38B533BL, 0xE630A6E0L, 0x1E136FE1L, 0x3BA89A3AL, 0x55648457L, 0x70DF718CL,
+        0xF0A8D0F6L, 0xD513252DL, 0xBBDF3B40L, 0x9E64CE9BL, 0x6647079AL, 0x43FCF241L,
+        0x2D30EC2CL, 0x088B19F7L, 0xD89B08DFL, 0xFD20FD04L, 0x93ECE369L, 0xB65716B2L,
+        0x4E74DFB3L, 0x6BCF2A68L, 0x05033405L, 0x20B8C1DEL, 0x4472B7B9L, 0x61C94262L,
+        0x0F055C0FL, 0x2ABEA9D4L, 0xD29D60D5L, 0xF726950EL, 0x99EA8B63L, 0xBC517EB8L,
+        0x6C416F90L, 0x49FA9A4BL, 0x27368426L, 0x028D71FDL, 0xFAAEB8FCL, 0xDF154D27L,
+        0xB1D9534AL, 0x9462A691L, 0x141507EBL, 0x31AEF230L, 0x5F62EC5DL, 0x7AD91986L,
+        0x82FAD087L, 0xA741255CL, 0xC98D3B31L, 0xEC36CEEAL, 0x3C26DFC2L, 0x199D2A19L,
+        0x77513474L, 0x52EAC1AFL, 0xAAC908AEL, 0x8F72FD75L, 0xE1BEE318L, 0xC40516C3L,
+        0xE4BDD71DL, 0xC10622C6L, 0xAFCA3CABL, 0x8A71C970L, 0x72520071L, 0x57E9F5AAL,
+        0x3925EBC7L, 0x1C9E1E1CL, 0xCC8E0F34L, 0xE935FAEFL, 0x87F9E482L, 0xA2421159L,
+        0x5A61D858L, 0x7FDA2D83L, 0x111633EEL, 0x34ADC635L, 0xB4DA674FL, 0x91619294L,
+        0xFFAD8CF9L, 0xDA167922L, 0x2235B023L, 0x078E45F8L, 0x69425B95L, 0x4CF9AE4EL,
+        0x9CE9BF66L, 0xB9524ABDL, 0xD79E54D0L, 0xF225A10BL, 0x0A06680AL, 0x2FBD9DD1L,
+        0x417183BCL, 0x64CA7667L, 0x88E56F72L, 0xAD5E9AA9L, 0xC39284C4L, 0xE629711FL,
+        0x1E0AB81EL, 0x3BB14DC5L, 0x557D53A8L, 0x70C6A673L, 0xA0D6B75BL, 0x856D4280L,
+        0xEBA15CEDL, 0xCE1AA936L, 0x36396037L, 0x138295ECL, 0x7D4E8B81L, 0x58F57E5AL,
+        0xD882DF20L, 0xFD392AFBL, 0x93F53496L, 0xB64EC14DL, 0x4E6D084CL, 0x6BD6FD97L,
+        0x051AE3FAL, 0x20A11621L, 0xF0B10709L, 0xD50AF2D2L, 0xBBC6ECBFL, 0x9E7D1964L,
+        0x665ED065L, 0x43E525BEL, 0x2D293BD3L, 0x0892CE08L, 0x282A0FD6L, 0x0D91FA0DL,
+        0x635DE460L, 0x46E611BBL, 0xBEC5D8BAL, 0x9B7E2D61L, 0xF5B2330CL, 0xD009C6D7L,
+        0x0019D7FFL, 0x25A22224L, 0x4B6E3C49L, 0x6ED5C992L, 0x96F60093L, 0xB34DF548L,
+        0xDD81EB25L, 0xF83A1EFEL, 0x784DBF84L, 0x5DF64A5FL, 0x333A5432L, 0x1681A1E9L,
+        0xEEA268E8L, 0xCB199D33L, 0xA5D5835EL, 0x806E7685L, 0x507E67ADL, 0x75C59276L,
+        0x1B098C1BL, 0x3EB279C0L, 0xC691B0C1L, 0xE32A451AL, 0x8DE65B77L, 0xA85DAEACL,
+        0xCC97D8CBL, 0xE92C2D10L, 0x87E0337DL, 0xA25BC6A6L, 0x5A780FA7L, 0x7FC3FA7CL,
+        0x110FE411L, 0x34B411CAL, 0xE4A400E2L, 0xC11FF539L, 0xAFD3EB54L, 0x8A681E8FL,
+        0x724BD78EL, 0x57F02255L, 0x393C3C38L, 0x1C87C9E3L, 0x9CF06899L, 0xB94B9D42L,
+        0xD787832FL, 0xF23C76F4L, 0x0A1FBFF5L, 0x2FA44A2EL, 0x41685443L, 0x64D3A198L,
+        0xB4C3B0B0L, 0x9178456BL, 0xFFB45B06L, 0xDA0FAEDDL, 0x222C67DCL, 0x07979207L,
+        0x695B8C6AL, 0x4CE079B1L, 0x6C58B86FL, 0x49E34DB4L, 0x272F53D9L, 0x0294A602L,
+        0xFAB76F03L, 0xDF0C9AD8L, 0xB1C084B5L, 0x947B716EL, 0x446B6046L, 0x61D0959DL,
+        0x0F1C8BF0L, 0x2AA77E2BL, 0xD284B72AL, 0xF73F42F1L, 0x99F35C9CL, 0xBC48A947L,
+        0x3C3F083DL, 0x1984FDE6L, 0x7748E38BL, 0x52F31650L, 0xAAD0DF51L, 0x8F6B2A8AL,
+        0xE1A734E7L, 0xC41CC13CL, 0x140CD014L, 0x31B725CFL, 0x5F7B3BA2L, 0x7AC0CE79L,
+        0x82E30778L, 0xA758F2A3L, 0xC994ECCEL, 0xEC2F1915L
+        }
+    };
+
+#endif  /* CRC32C_HAVE_SSE42 */
@@ -0,0 +1,200 @@
+/**
+ * Build-time generator for the constant CRC tables, so that they are placed in
+ * Flash (or '.rodata'), and the CRC routines need no run-time initialisation.
+ *
+ * Usage:
+ *   ./crctab stm32 > stm32crc_tab.h
+ *   ./crctab crc32c > crc32c_tab.h
+ *
+ * Note(s):
+ *  - this is a host tool, and is not part of the library;
+ *  - the generated headers are committed, so that projects that just copy the
+ *    sources (for example, into an STM32 IDE project) do not need to run it;
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+
+#define STM32_POLY   0x04C11DB7u
+#define STM32_SLICES 16
+
+// CRC-32C (Castagnoli), reflected
+#define CRC32C_POLY   0x82F63B78u
+#define CRC32C_SLICES 8
+#define CRC32C_LONG   8192
+#define CRC32C_SHORT  256
+
+
+// -- Table generation -- //
+
+/**
+ * MSB-first (non-reflected) tables, where 'tab[k][i]' is the CRC of the byte
+ * 'i' followed by 'k' zero bytes.
+ */
+static void msb_tables(uint32_t tab[][256], int slices, uint32_t poly)
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i << 24;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc << 1) ^ ((crc >> 31) * poly);
+        }
+        tab[0][i] = crc;
+    }
+
+    for (int k = 1; k < slices; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t crc = tab[k-1][i];
+            tab[k][i] = (crc << 8) ^ tab[0][crc >> 24];
+        }
+    }
+}
+
+/**
+ * LSB-first (reflected) tables, where 'tab[k][i]' is the CRC of the byte 'i'
+ * followed by 'k' zero bytes.
+ */
+static void lsb_tables(uint32_t tab[][256], int slices, uint32_t poly)
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ ((crc & 1) * poly);
+        }
+        tab[0][i] = crc;
+    }
+
+    for (int k = 1; k < slices; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t crc = tab[k-1][i];
+            tab[k][i] = (crc >> 8) ^ tab[0][crc & 0xff];
+        }
+    }
+}
+
+/**
+ * LSB-first "shift" tables, that apply 'len' zero bytes to a (raw) register
+ * value, one byte of the register at a time:
+ *   shift(crc) = zeros[0][crc & 0xff] ^ zeros[1][(crc >> 8) & 0xff] ^ ...
+ */
+static void lsb_zeros(uint32_t zeros[4][256], const uint32_t tab[256], int len)
+{
+    for (int k = 0; k < 4; k++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i << (8 * k);
+            for (int j = len; j--;) {
+                crc = (crc >> 8) ^ tab[crc & 0xff];
+            }
+            zeros[k][i] = crc;
+        }
+    }
+}
+
+
+// -- Output -- //
+
+static void emit_table(const uint32_t tab[256])
+{
+    printf("        {\n");
+    for (int i = 0; i < 256; i += 6) {
+        printf("       ");
+        for (int j = i; j < i + 6 && j < 256; j++) {
+            printf(" 0x%08XL%s", tab[j], j < 255 ? "," : "");
+        }
+        printf("\n");
+    }
+    printf("        }");
+}
+
+static void emit_tables(const char* decl, const uint32_t tab[][256], int num)
+{
+    printf("%s =\n    {\n", decl);
+    for (int k = 0; k < num; k++) {
+        emit_table(tab[k]);
+        printf("%s\n", k < num - 1 ? "," : "");
+    }
+    printf("    };\n");
+}
+
+static void emit_stm32(void)
+{
+    static uint32_t tab[STM32_SLICES][256];
+
+    msb_tables(tab, STM32_SLICES, STM32_POLY);
+
+    printf("/*\n"
+           " * File:    src/stm32crc_tab.h\n"
+           " *\n"
+           " * Generated by src/crctab.c, do not edit.\n"
+           " *\n"
+           " * Description\n"
+           " * -----------\n"
+           " * Slicing tables for the (MSB-first) CRC-32 polynomial 0x%08X, where\n"
+           " * 'crc_tab32[k][i]' is the CRC of the byte 'i' followed by 'k' zero bytes.\n"
+           " * Only the tables required by STM32CRC_SLICING are compiled in.\n"
+           " */\n\n", STM32_POLY);
+
+    printf("static const uint32_t   crc_tab32[STM32CRC_SLICING][256] =\n    {\n");
+    for (int k = 0; k < STM32_SLICES; k++) {
+        if (k == 1) {
+            printf("\n#if STM32CRC_SLICING > 1\n");
+        } else if (k == 8) {
+            printf("\n#if STM32CRC_SLICING > 8\n");
+        }
+        emit_table(tab[k]);
+        printf("%s\n", k < STM32_SLICES - 1 ? "," : "");
+        if (k == 7 || k == 15) {
+            printf("#endif\n");
+        }
+    }
+    printf("    };\n");
+}
+
+static void emit_crc32c(void)
+{
+    static uint32_t tab[CRC32C_SLICES][256];
+    static uint32_t zeros[4][256];
+
+    lsb_tables(tab, CRC32C_SLICES, CRC32C_POLY);
+
+    printf("/*\n"
+           " * File:    src/crc32c_tab.h\n"
+           " *\n"
+           " * Generated by src/crctab.c, do not edit.\n"
+           " *\n"
+           " * Description\n"
+           " * -----------\n"
+           " * Slicing tables for the (reflected) CRC-32C polynomial 0x%08X, and the\n"
+           " * tables that shift a register past %d and %d zero bytes, which are used to\n"
+           " * combine the interleaved streams of the SSE4.2 engine.\n"
+           " */\n\n", CRC32C_POLY, CRC32C_LONG, CRC32C_SHORT);
+
+    printf("#define CRC32C_LONG  %d\n", CRC32C_LONG);
+    printf("#define CRC32C_SHORT %d\n\n", CRC32C_SHORT);
+
+    emit_tables("static const uint32_t crc32c_tab[8][256]", tab, CRC32C_SLICES);
+
+    printf("\n#ifdef CRC32C_HAVE_SSE42\n\n");
+    lsb_zeros(zeros, tab[0], CRC32C_LONG);
+    emit_tables("static const uint32_t crc32c_long[4][256]", zeros, 4);
+    printf("\n");
+    lsb_zeros(zeros, tab[0], CRC32C_SHORT);
+    emit_tables("static const uint32_t crc32c_short[4][256]", zeros, 4);
+    printf("\n#endif  /* CRC32C_HAVE_SSE42 */\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    if (argc == 2 && strcmp(argv[1], "stm32") == 0) {
+        emit_stm32();
+        return 0;
+    } else if (argc == 2 && strcmp(argv[1], "crc32c") == 0) {
+        emit_crc32c();
+        return 0;
+    }
+
+    fprintf(stderr, "Usage: %s stm32|crc32c\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,33 @@
+#include "mpmcq.h"
+
+/**
+ * Creates an MPMC queue of 'size' items, in the memory at 'mq_ptr', which must
+ * hold at least 'MQ_BYTES(size, typ)' bytes.
+ *
+ * Note(s):
+ *  - 'size' must be a power of two;
+ *  - the queue must not be in use while it is (re-)created;
+ */
+mpmcq_t* mq_create(void* mq_ptr, int32_t size)
+{
+    mpmcq_t* mq = (mpmcq_t*) mq_ptr;
+    rb_index_t* seq = (rb_index_t*)((uint8_t*)mq_ptr + sizeof(mpmcq_t));
+    void* data = (uint8_t*)mq_ptr + MQ_HEADER(size);
+
+    for (int32_t i=0; i<size; i++) {
+        __RB_STORE(seq[i], i, relaxed);
+    }
+
+    __RB_STORE(mq->enq.pos, 0, relaxed);
+    mq->enq.wrap = size - 1;
+    mq->enq.seq = seq;
+    mq->enq.data = data;
+
+    __RB_STORE(mq->deq.pos, 0, relaxed);
+    mq->deq.wrap = size - 1;
+    mq->deq.seq = seq;
+    mq->deq.data = data;
+
+    atomic_thread_fence(memory_order_release);
+    return mq;
+}
@@ -0,0 +1,145 @@
+#ifndef __MPMCQ_H__
+#define __MPMCQ_H__
+
+/**
+ * Bounded multi-producer, multi-consumer (MPMC) queue, using a sequence number
+ * per slot (after D. Vyukov), so that any number of threads may push and pop
+ * concurrently, without locks.
+ *
+ * Note(s):
+ *  - 'size' must be a power of two, and (unlike 'ringbuf_t') all 'size' slots
+ *    can be used;
+ *  - the enqueue and dequeue positions are free-running counters, on separate
+ *    cache-lines, and the slot index is 'pos & wrap';
+ *  - a slot's sequence number is 'pos' when it is free for the producer that
+ *    claims 'pos', and 'pos + 1' once it holds data for the consumer that claims
+ *    'pos', so producers (and consumers) only contend on their own counter;
+ *  - the memory should be aligned to 'RB_CACHE_LINE' bytes, and hold at least
+ *    'MQ_BYTES(size, typ)' bytes, for the queue, then the sequence numbers, and
+ *    then the data (which starts on a cache-line);
+ */
+
+#include <stddef.h>
+#include "ringbuf.h"
+
+
+// -- Data types -- //
+
+typedef struct {
+    rb_index_t pos;
+    int32_t wrap;
+    rb_index_t* seq;
+    void* data;
+} __attribute__((aligned(RB_CACHE_LINE))) mpmcq_side_t;
+
+typedef struct {
+    mpmcq_side_t enq;
+    mpmcq_side_t deq;
+} mpmcq_t;
+
+// Bytes for the queue, and its sequence numbers, which are padded to a cache-line
+#define MQ_HEADER(size)     ((sizeof(mpmcq_t) + (size) * sizeof(rb_index_t) + RB_CACHE_LINE - 1) & ~(size_t)(RB_CACHE_LINE - 1))
+#define MQ_BYTES(size, typ) (MQ_HEADER(size) + (size) * sizeof(typ))
+
+
+// -- Private macros -- //
+
+// Note: positions wrap around 2^32, so their differences are calculated using
+//   unsigned arithmetic, and then interpreted as signed.
+#define __MQ_DIFF(a, b)     ((int32_t)((uint32_t)(a) - (uint32_t)(b)))
+#define __MQ_NEXT(a, n)     ((int32_t)((uint32_t)(a) + (uint32_t)(n)))
+
+#define __MQ_PUSH(mq, typ, elem)                                \
+    int32_t pos = __RB_LOAD(mq->enq.pos, relaxed);              \
+    rb_index_t* seq;                                            \
+    for (;;)                                                    \
+    {                                                           \
+        seq = &mq->enq.seq[pos & mq->enq.wrap];                 \
+        int32_t dif = __MQ_DIFF(__RB_LOAD(*seq, acquire), pos); \
+        if (dif == 0)                                           \
+        {                                                       \
+            if (__RB_CAS(mq->enq.pos, &pos, __MQ_NEXT(pos, 1), relaxed)) \
+                break;                                          \
+        }                                                       \
+        else if (dif < 0)                                       \
+        {                                                       \
+            return 0;                                           \
+        }                                                       \
+        else                                                    \
+        {                                                       \
+            pos = __RB_LOAD(mq->enq.pos, relaxed);              \
+        }                                                       \
+    }                                                           \
+    ((typ*)mq->enq.data)[pos & mq->enq.wrap] = elem;            \
+    __RB_STORE(*seq, __MQ_NEXT(pos, 1), release);               \
+    return 1;
+
+#define __MQ_POP(mq, typ, elem)                                 \
+    int32_t pos = __RB_LOAD(mq->deq.pos, relaxed);              \
+    rb_index_t* seq;                                            \
+    for (;;)                                                    \
+    {                                                           \
+        seq = &mq->deq.seq[pos & mq->deq.wrap];                 \
+        int32_t dif = __MQ_DIFF(__RB_LOAD(*seq, acquire), __MQ_NEXT(pos, 1)); \
+        if (dif == 0)                                           \
+        {                                                       \
+            if (__RB_CAS(mq->deq.pos, &pos, __MQ_NEXT(pos, 1), relaxed)) \
+                break;                                          \
+        }                                                       \
+        else if (dif < 0)                                       \
+        {                                                       \
+            return 0;                                           \
+        }                                                       \
+        else                                                    \
+        {                                                       \
+            pos = __RB_LOAD(mq->deq.pos, relaxed);              \
+        }                                                       \
+    }                                                           \
+    *elem = ((typ*)mq->deq.data)[pos & mq->deq.wrap];           \
+    __RB_STORE(*seq, __MQ_NEXT(pos, mq->deq.wrap + 1), release); \
+    return 1;
+
+
+// -- User macros -- //
+
+#define MQ_MAKE_PUSH(typ)                               \
+    static inline int mq_push(mpmcq_t* mq, typ x)       \
+    {                                                   \
+        __MQ_PUSH(mq, typ, x);                          \
+    }
+
+#define MQ_MAKE_POP(typ)                                \
+    static inline int mq_pop(mpmcq_t* mq, typ* p)       \
+    {                                                   \
+        __MQ_POP(mq, typ, p);                           \
+    }
+
+
+// -- Inlinable user functions -- //
+
+/**
+ * Number of items in the queue, which is only a snapshot, while there are
+ * concurrent pushes and pops.
+ */
+static inline int32_t mq_count(mpmcq_t* mq)
+    {
+    int32_t count = __MQ_DIFF(__RB_LOAD(mq->enq.pos, acquire), __RB_LOAD(mq->deq.pos, acquire));
+    return count < 0 ? 0 : count > mq->enq.wrap + 1 ? mq->enq.wrap + 1 : count;
+    }
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+    mpmcq_t* mq_create(void* mq_ptr, int32_t size);
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __MPMCQ_H__ */
@@ -0,0 +1,51 @@
+#include "rbcast.h"
+
+/**
+ * Creates a broadcast ring-buffer of 'size' items, with 'readers' readers, in
+ * the memory at 'rb_ptr', which must hold at least 'RBC_BYTES(size, readers,
+ * typ)' bytes.
+ *
+ * Note(s):
+ *  - 'size' must be a power of two;
+ *  - if 'overwrite' is non-zero, then the writer never waits for the readers;
+ */
+rbcast_t* rbc_create(void* rb_ptr, int32_t size, int32_t readers, int overwrite)
+{
+    rbcast_t* rb = (rbcast_t*) rb_ptr;
+    rbcast_reader_t* reader = (rbcast_reader_t*)((uint8_t*)rb_ptr + sizeof(rbcast_t));
+
+    for (int32_t i=0; i<readers; i++) {
+        __RB_STORE(reader[i].cursor, 0, relaxed);
+        reader[i].cache = 0;
+        reader[i].lost = 0;
+    }
+
+    __RB_STORE(rb->head, 0, relaxed);
+    rb->slow = 0;
+    rb->wrap = size - 1;
+    rb->overwrite = overwrite;
+    rb->readers = readers;
+    rb->data = (void*)(reader + readers);
+    rb->reader = reader;
+
+    __RB_FENCE(release);
+    return rb;
+}
+
+/**
+ * Returns the cursor of the slowest reader, which is the one furthest behind
+ * 'head', and is called by the writer, when its cached copy says "full."
+ */
+int32_t rbc_slowest(rbcast_t* rb)
+{
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t slow = head;
+
+    for (int32_t i=0; i<rb->readers; i++) {
+        int32_t cur = __RB_LOAD(rb->reader[i].cursor, acquire);
+        if (__MQ_DIFF(head, cur) > __MQ_DIFF(head, slow)) {
+            slow = cur;
+        }
+    }
+    return slow;
+}
@@ -0,0 +1,168 @@
+#ifndef __RBCAST_H__
+#define __RBCAST_H__
+
+/**
+ * Broadcast ring-buffer, with a single writer, and a fixed number of readers,
+ * each with its own cursor, so that each item is written once, and read by
+ * every reader.
+ *
+ * Note(s):
+ *  - 'head' and the cursors are free-running counters (and the slot index is
+ *    'pos & wrap'), so all 'size' slots can be used, and a reader's backlog
+ *    is just 'head - cursor';
+ *  - by default, the writer waits for the slowest reader, and 'rbc_push(..)'
+ *    fails while the slowest reader is 'size' items behind;
+ *  - in "overwrite" mode, the writer never waits, and a reader that falls
+ *    behind skips the items that were overwritten, and counts them as lost,
+ *    which 'rbc_lost(..)' returns;
+ *  - in "overwrite" mode, a reader copies the item, and then re-checks 'head'
+ *    (as for a sequence lock), to see whether the item was overwritten while
+ *    it was being copied, so the items should be small;
+ *  - the writer keeps a cached copy of the slowest cursor, and each reader a
+ *    cached copy of 'head', and each is on its own cache-line;
+ *  - the memory should be aligned to 'RB_CACHE_LINE' bytes, and hold at least
+ *    'RBC_BYTES(size, readers, typ)' bytes;
+ */
+
+#include <stddef.h>
+#include "ringbuf.h"
+#include "mpmcq.h"
+
+
+// -- Data types -- //
+
+typedef struct {
+    rb_index_t head;
+    int32_t slow;
+    int32_t wrap;
+    int32_t overwrite;
+    int32_t readers;
+    void* data;
+    struct rbcast_reader_s* reader;
+} __attribute__((aligned(RB_CACHE_LINE))) rbcast_t;
+
+typedef struct rbcast_reader_s {
+    rb_index_t cursor;
+    int32_t cache;
+    uint32_t lost;
+} __attribute__((aligned(RB_CACHE_LINE))) rbcast_reader_t;
+
+#define RBC_BYTES(size, readers, typ) \
+    (sizeof(rbcast_t) + (readers) * sizeof(rbcast_reader_t) + (size) * sizeof(typ))
+
+
+// -- Private macros -- //
+
+#define __RBC_PUSH(rb, typ, elem)                                       \
+    int32_t head = __RB_LOAD(rb->head, relaxed);                        \
+    if (rb->overwrite)                                                  \
+    {                                                                   \
+        /* Publish the previous 'head' before overwriting the slot */   \
+        __RB_FENCE(release);                                            \
+    }                                                                   \
+    else if (__MQ_DIFF(head, rb->slow) > rb->wrap)                      \
+    {                                                                   \
+        rb->slow = rbc_slowest(rb);                                     \
+        if (__MQ_DIFF(head, rb->slow) > rb->wrap)                       \
+        {                                                               \
+            return 0;                                                   \
+        }                                                               \
+    }                                                                   \
+    ((typ*)rb->data)[head & rb->wrap] = elem;                           \
+    __RB_STORE(rb->head, __MQ_NEXT(head, 1), release);                  \
+    return 1;
+
+// Note: in "overwrite" mode, the item at 'cur' is valid until 'head' reaches
+//   'cur + size', since the writer may then be writing its slot.
+#define __RBC_POP(rb, i, typ, elem)                                     \
+    rbcast_reader_t* r = &rb->reader[i];                                \
+    int32_t cur = __RB_LOAD(r->cursor, relaxed);                        \
+    for (;;)                                                            \
+    {                                                                   \
+        if (cur == r->cache)                                            \
+        {                                                               \
+            r->cache = __RB_LOAD(rb->head, acquire);                    \
+            if (cur == r->cache)                                        \
+            {                                                           \
+                __RB_STORE(r->cursor, cur, release);                    \
+                return 0;                                               \
+            }                                                           \
+        }                                                               \
+        if (!rb->overwrite)                                             \
+        {                                                               \
+            *elem = ((typ*)rb->data)[cur & rb->wrap];                   \
+            break;                                                      \
+        }                                                               \
+        int32_t lag = __MQ_DIFF(r->cache, cur);                         \
+        if (lag > rb->wrap)                                             \
+        {                                                               \
+            /* Overrun, so skip to the oldest item that may be valid */ \
+            r->lost += lag - rb->wrap;                                  \
+            cur = __MQ_NEXT(r->cache, -rb->wrap);                       \
+        }                                                               \
+        *elem = ((typ*)rb->data)[cur & rb->wrap];                       \
+        __RB_FENCE(acquire);                                            \
+        r->cache = __RB_LOAD(rb->head, relaxed);                        \
+        if (__MQ_DIFF(r->cache, cur) <= rb->wrap)                       \
+        {                                                               \
+            break;                                                      \
+        }                                                               \
+        /* Overwritten while it was copied */                           \
+        r->lost++;                                                      \
+        cur = __MQ_NEXT(cur, 1);                                        \
+    }                                                                   \
+    __RB_STORE(r->cursor, __MQ_NEXT(cur, 1), release);                  \
+    return 1;
+
+
+// -- User macros -- //
+
+#define RBC_MAKE_PUSH(typ)                                              \
+    static inline int rbc_push(rbcast_t* rb, typ x)                     \
+    {                                                                   \
+        __RBC_PUSH(rb, typ, x);                                         \
+    }
+
+#define RBC_MAKE_POP(typ)                                               \
+    static inline int rbc_pop(rbcast_t* rb, int32_t reader, typ* p)     \
+    {                                                                   \
+        __RBC_POP(rb, reader, typ, p);                                  \
+    }
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+    rbcast_t* rbc_create(void* rb_ptr, int32_t size, int32_t readers, int overwrite);
+    int32_t rbc_slowest(rbcast_t* rb);
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+// -- Inlinable user functions -- //
+
+/**
+ * Number of items that 'reader' has yet to read (which may be more than 'size',
+ * in "overwrite" mode, if it has fallen behind).
+ */
+static inline int32_t rbc_count(rbcast_t* rb, int32_t reader)
+    {
+    return __MQ_DIFF(__RB_LOAD(rb->head, acquire), __RB_LOAD(rb->reader[reader].cursor, acquire));
+    }
+
+/**
+ * Number of items that 'reader' has missed, because they were overwritten.
+ */
+static inline uint32_t rbc_lost(rbcast_t* rb, int32_t reader)
+    {
+    return rb->reader[reader].lost;
+    }
+
+
+#endif /* __RBCAST_H__ */
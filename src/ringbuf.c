@@ -2,7 +2,8 @@
 #include "ringbuf.h"
 
 /**
- * Ring-buffer that stores up to 'n-1' items, and is concurrency-safe.
+ * Ring-buffer that stores up to 'n-1' items, and is lock-free for a single
+ * producer, and a single consumer.
  *
  * Note(s):
  *  - 'wrap' is one less than 'size', and 'size' must be a power of two;
@@ -14,8 +15,8 @@ ringbuf_t* rb_create(void* rb_ptr, int32_t size)
     ringbuf_t *rb = (ringbuf_t*) rb_ptr;
 
     rb->wrap = size - 1;
-    rb->head = 0;
-    rb->tail = 0;
+    __RB_STORE(rb->head, 0, relaxed);
+    __RB_STORE(rb->tail, 0, relaxed);
     rb->data = rb_ptr + sizeof(ringbuf_t);
 
     return rb;
@@ -31,7 +32,7 @@ ringbuf_t* rb_create(void* rb_ptr, int32_t size)
  */
 void rb_clear(ringbuf_t* rb)
     {
-    rb->tail = rb->head;
+    __RB_STORE(rb->tail, __RB_LOAD(rb->head, acquire), release);
     }
 
 /**
@@ -40,8 +41,8 @@ void rb_clear(ringbuf_t* rb)
  */
 int32_t rb_copy(ringbuf_t* rb, const uint8_t* src, int32_t len)
     {
-    int32_t count = rb_space(rb);
-    int32_t head = rb->head;
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
     uint8_t* dst;
 
     if (count < len)
@@ -68,17 +69,16 @@ int32_t rb_copy(ringbuf_t* rb, const uint8_t* src, int32_t len)
     head += len;
     count += len;
 
-    // Update the 'ringbuf_t'
-    // Todo: atomically ??
-    rb->head = head & rb->wrap;
+    // Publish the new "head," after the bytes have been written
+    __RB_STORE(rb->head, head & rb->wrap, release);
 
     return count;
     }
 
 int32_t rb_many(ringbuf_t* rb, uint8_t val, int32_t len)
 {
-    int32_t count = rb_space(rb);
-    int32_t head = rb->head;
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
     uint8_t* dst;
 
     if (count > len) {
@@ -101,8 +101,8 @@ int32_t rb_many(ringbuf_t* rb, uint8_t val, int32_t len)
     memset((void*)dst, val, count);
     head += count;
 
-    // Update the 'ringbuf_t'
-    rb->head = head & rb->wrap;
+    // Publish the new "head," after the bytes have been written
+    __RB_STORE(rb->head, head & rb->wrap, release);
     return len;
 }
 
@@ -112,8 +112,8 @@ int32_t rb_many(ringbuf_t* rb, uint8_t val, int32_t len)
  */
 int32_t rb_take(ringbuf_t* rb, uint8_t* dst, int32_t len)
     {
-    int32_t count = rb_count(rb);
-    int32_t tail = rb->tail;
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t count = (__RB_LOAD(rb->head, acquire) - tail) & rb->wrap;
     uint8_t* src;
 
     if (count < len)
@@ -123,12 +123,12 @@ int32_t rb_take(ringbuf_t* rb, uint8_t* dst, int32_t len)
         }
     count = 0;
 
-    if (tail + count > rb->wrap)
+    if (tail + len > rb->wrap)
         {
         // If 'len' requires a "wrap," then first take to the end of the buffer
         count = rb->wrap - tail + 1;
 	src = (uint8_t*)rb->data + tail;
-        memcpy((void*)dst, (const void*)src, len);
+        memcpy((void*)dst, (const void*)src, count);
         len -= count;
 	dst += count;
         tail = 0;
@@ -140,9 +140,8 @@ int32_t rb_take(ringbuf_t* rb, uint8_t* dst, int32_t len)
     tail += len;
     count += len;
 
-    // Update the 'ringbuf_t'
-    // Todo: atomically ??
-    rb->tail = tail & rb->wrap;
+    // Release the space, after the bytes have been read
+    __RB_STORE(rb->tail, tail & rb->wrap, release);
 
     return count;
     }
@@ -153,28 +152,236 @@ int32_t rb_take(ringbuf_t* rb, uint8_t* dst, int32_t len)
  */
 int32_t rb_drop(ringbuf_t* rb, int32_t len)
     {
-    int32_t count = rb_count(rb);
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t count = (__RB_LOAD(rb->head, acquire) - tail) & rb->wrap;
 
     if (count < len)
         {
         // Partial drop
         len = count;
         }
-    rb->tail = (rb->tail + len) & rb->wrap;
+    __RB_STORE(rb->tail, (tail + len) & rb->wrap, release);
 
     return len;
     }
 
 
+/**
+ * Reserve up to 'want' bytes of contiguous space, at the "head," for writing in
+ * place (for example, by DMA or 'read()'), and returns the number of bytes that
+ * can be written at '*ptr'.
+ *
+ * Note(s):
+ *  - the span stops at the end of the buffer, so a second reservation (after
+ *    the commit) may be needed to fill the space after a wrap;
+ *  - nothing is visible to the consumer until 'rb_commit(..)';
+ */
+int32_t rb_reserve(ringbuf_t* rb, uint8_t** ptr, int32_t want)
+{
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
+    int32_t span = rb->wrap - head + 1;
+
+    if (count > span) {
+        count = span;
+    }
+    if (count > want) {
+        count = want;
+    }
+    *ptr = (uint8_t*)rb->data + head;
+
+    return count;
+}
+
+/**
+ * Publish 'len' bytes that were written in place, after 'rb_reserve(..)', and
+ * returns the number of bytes committed.
+ */
+int32_t rb_commit(ringbuf_t* rb, int32_t len)
+{
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
+
+    if (count < len) {
+        len = count;
+    }
+    __RB_STORE(rb->head, (head + len) & rb->wrap, release);
+
+    return len;
+}
+
+/**
+ * Get the largest contiguous span of bytes, at the "tail," for reading in place
+ * (for example, by DMA or 'write()'), and returns its length.
+ *
+ * Note(s):
+ *  - the span stops at the end of the buffer, so any bytes after a wrap are
+ *    returned by the next peek, after 'rb_consume(..)';
+ */
+int32_t rb_peek(ringbuf_t* rb, const uint8_t** ptr)
+{
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t count = (__RB_LOAD(rb->head, acquire) - tail) & rb->wrap;
+    int32_t span = rb->wrap - tail + 1;
+
+    *ptr = (const uint8_t*)rb->data + tail;
+
+    return count < span ? count : span;
+}
+
+/**
+ * Release 'len' bytes that were read in place, after 'rb_peek(..)', and returns
+ * the number of bytes consumed.
+ */
+int32_t rb_consume(ringbuf_t* rb, int32_t len)
+{
+    return rb_drop(rb, len);
+}
+
+
+/**
+ * Write a length-prefixed record, which becomes visible to the consumer all at
+ * once, and returns the number of payload bytes written, or 'RB_RECORD_NONE'
+ * if there is not enough space (or 'len' is invalid), in which case nothing is
+ * written.
+ *
+ * Note(s):
+ *  - the buffer size must be a multiple of four (which a power of two, of at
+ *    least four, is), and the buffer should only hold records;
+ *  - a record needs 'RB_RECORD_BYTES(len)' bytes, plus any bytes to the end of
+ *    the buffer, if it won't fit before the wrap;
+ *  - a record can use up to half of the buffer, since then there is always
+ *    a contiguous region that it fits in, once the buffer is (nearly) empty;
+ */
+int32_t rb_put_record(ringbuf_t* rb, const uint8_t* src, int32_t len)
+{
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t space = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
+    int32_t span = rb->wrap - head + 1;
+    uint8_t* data = (uint8_t*)rb->data;
+    uint32_t word = (uint32_t)len;
+    int32_t need;
+
+    // Bound 'len' first, as rounding it up could overflow
+    if (len < 0 || len > (rb->wrap + 1) / 2) {
+        return RB_RECORD_NONE;
+    }
+    need = RB_RECORD_BYTES(len);
+    if (need > (rb->wrap + 1) / 2) {
+        // Might never fit
+        return RB_RECORD_NONE;
+    }
+
+    if (need > span) {
+        // Mark the rest of the buffer as padding, and start at the beginning
+        if (space < span + need) {
+            return RB_RECORD_NONE;
+        }
+        word = RB_RECORD_PAD;
+        memcpy(data + head, &word, 4);
+        word = (uint32_t)len;
+        head = 0;
+    } else if (space < need) {
+        return RB_RECORD_NONE;
+    }
+
+    memcpy(data + head, &word, 4);
+    memcpy(data + head + 4, src, len);
+
+    // Publish the whole record (and any padding) at once
+    __RB_STORE(rb->head, (head + need) & rb->wrap, release);
+    return len;
+}
+
+/**
+ * Get the next record, in place, by skipping any padding, and returns its
+ * length, or 'RB_RECORD_NONE' (and sets '*ptr' to NULL) if there isn't one.
+ *
+ * Note(s):
+ *  - the record stays in the buffer, until 'rb_drop_record(..)';
+ */
+int32_t rb_peek_record(ringbuf_t* rb, const uint8_t** ptr)
+{
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t head = __RB_LOAD(rb->head, acquire);
+    const uint8_t* data = (const uint8_t*)rb->data;
+    uint32_t word;
+
+    *ptr = NULL;
+    if (tail == head) {
+        return RB_RECORD_NONE;
+    }
+
+    memcpy(&word, data + tail, 4);
+    if (word == RB_RECORD_PAD) {
+        // Release the padding, since the record (if any) is at the start
+        tail = 0;
+        __RB_STORE(rb->tail, tail, release);
+        if (tail == head) {
+            return RB_RECORD_NONE;
+        }
+        memcpy(&word, data, 4);
+    }
+
+    *ptr = data + tail + 4;
+    return (int32_t)word;
+}
+
+/**
+ * Releases a record, that was just peeked at '*ptr', with length 'len'.
+ */
+static inline void release_record(ringbuf_t* rb, const uint8_t* ptr, int32_t len)
+{
+    int32_t tail = (int32_t)(ptr - 4 - (const uint8_t*)rb->data);
+    __RB_STORE(rb->tail, (tail + RB_RECORD_BYTES(len)) & rb->wrap, release);
+}
+
+/**
+ * Drop the next record (if any), and returns its length, or 'RB_RECORD_NONE'.
+ */
+int32_t rb_drop_record(ringbuf_t* rb)
+{
+    const uint8_t* ptr;
+    int32_t len = rb_peek_record(rb, &ptr);
+
+    if (len != RB_RECORD_NONE) {
+        release_record(rb, ptr, len);
+    }
+    return len;
+}
+
+/**
+ * Take the next record, and returns its length, or 'RB_RECORD_NONE' if there
+ * isn't one, or 'RB_RECORD_TOO_BIG' if it's longer than 'max' bytes (and then
+ * it stays in the buffer).
+ */
+int32_t rb_get_record(ringbuf_t* rb, uint8_t* dst, int32_t max)
+{
+    const uint8_t* ptr;
+    int32_t len = rb_peek_record(rb, &ptr);
+
+    if (len == RB_RECORD_NONE) {
+        return len;
+    } else if (len > max) {
+        return RB_RECORD_TOO_BIG;
+    }
+
+    memcpy(dst, ptr, len);
+    release_record(rb, ptr, len);
+    return len;
+}
+
+
 /**
  * Acquire an index into a buffer of buffers/structs.
  */
 int rb_acquire(ringbuf_t* rb, int32_t* index)
 {
-    if (rb_count(rb) < rb->wrap)
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    if (((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap) < rb->wrap)
     {
-        *index = rb->head++;
-        rb->head &= rb->wrap;
+        *index = head;
+        __RB_STORE(rb->head, (head + 1) & rb->wrap, release);
         return 1;
     }
     else
@@ -188,9 +395,10 @@ int rb_acquire(ringbuf_t* rb, int32_t* index)
  */
 int rb_current(ringbuf_t* rb, int32_t* index)
 {
-    if (rb_count(rb) > 0)
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    if (tail != __RB_LOAD(rb->head, acquire))
     {
-        *index = rb->tail;
+        *index = tail;
         return 1;
     }
     else
@@ -204,10 +412,10 @@ int rb_current(ringbuf_t* rb, int32_t* index)
  */
 int rb_release(ringbuf_t* rb)
 {
-    int32_t tail = rb->tail;
-    if (tail++ != rb->head)
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    if (tail++ != __RB_LOAD(rb->head, acquire))
     {
-        rb->tail = tail & rb->wrap;
+        __RB_STORE(rb->tail, tail & rb->wrap, release);
         return 1;
     }
     else
@@ -215,3 +423,103 @@ int rb_release(ringbuf_t* rb)
         return 0;
     }
 }
+
+
+// -- Padded ring-buffer -- //
+
+/**
+ * Padded version of 'rb_create(..)', where 'rb_ptr' should be aligned to a
+ * cache-line, and is followed by the 'size'-byte (or item) buffer.
+ */
+rbpad_t* rbp_create(void* rb_ptr, int32_t size)
+{
+    rbpad_t* rb = (rbpad_t*) rb_ptr;
+    void* data = rb_ptr + sizeof(rbpad_t);
+
+    __RB_STORE(rb->prod.index, 0, relaxed);
+    rb->prod.cache = 0;
+    rb->prod.wrap = size - 1;
+    rb->prod.data = data;
+
+    __RB_STORE(rb->cons.index, 0, relaxed);
+    rb->cons.cache = 0;
+    rb->cons.wrap = size - 1;
+    rb->cons.data = data;
+
+    return rb;
+}
+
+/**
+ * Clears the contents of a 'rbpad_t', and must be called from the "pop" thread.
+ */
+void rbp_clear(rbpad_t* rb)
+{
+    rb->cons.cache = __RB_LOAD(rb->prod.index, acquire);
+    __RB_STORE(rb->cons.index, rb->cons.cache, release);
+}
+
+/**
+ * Padded version of 'rb_copy(..)', which only refreshes the cached "tail" when
+ * there isn't enough space for all 'len' bytes.
+ */
+int32_t rbp_copy(rbpad_t* rb, const uint8_t* src, int32_t len)
+{
+    const int32_t wrap = rb->prod.wrap;
+    int32_t head = __RB_LOAD(rb->prod.index, relaxed);
+    int32_t count = wrap - ((head - rb->prod.cache) & wrap);
+    uint8_t* data = (uint8_t*)rb->prod.data;
+
+    if (count < len) {
+        rb->prod.cache = __RB_LOAD(rb->cons.index, acquire);
+        count = wrap - ((head - rb->prod.cache) & wrap);
+        if (count < len) {
+            // Partial fill
+            len = count;
+        }
+    }
+
+    count = wrap - head + 1;
+    if (len > count) {
+        // If 'len' requires a "wrap," then first fill to the end of the buffer
+        memcpy(data + head, src, count);
+        memcpy(data, src + count, len - count);
+    } else {
+        memcpy(data + head, src, len);
+    }
+
+    __RB_STORE(rb->prod.index, (head + len) & wrap, release);
+    return len;
+}
+
+/**
+ * Padded version of 'rb_take(..)', which only refreshes the cached "head" when
+ * there aren't enough bytes to fill all of 'len'.
+ */
+int32_t rbp_take(rbpad_t* rb, uint8_t* dst, int32_t len)
+{
+    const int32_t wrap = rb->cons.wrap;
+    int32_t tail = __RB_LOAD(rb->cons.index, relaxed);
+    int32_t count = (rb->cons.cache - tail) & wrap;
+    const uint8_t* data = (const uint8_t*)rb->cons.data;
+
+    if (count < len) {
+        rb->cons.cache = __RB_LOAD(rb->prod.index, acquire);
+        count = (rb->cons.cache - tail) & wrap;
+        if (count < len) {
+            // Partial take
+            len = count;
+        }
+    }
+
+    count = wrap - tail + 1;
+    if (len > count) {
+        // If 'len' requires a "wrap," then first take to the end of the buffer
+        memcpy(dst, data + tail, count);
+        memcpy(dst + count, data, len - count);
+    } else {
+        memcpy(dst, data + tail, len);
+    }
+
+    __RB_STORE(rb->cons.index, (tail + len) & wrap, release);
+    return len;
+}
@@ -3,12 +3,45 @@
 
 
 #include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif
+
+
+// -- Atomic indices -- //
+
+// The indices are lock-free atomics, with the same size (and alignment) as an
+// 'int32_t', so the layout of a 'ringbuf_t' is unchanged.
+#ifdef __cplusplus
+typedef std::atomic<int32_t> rb_index_t;
+#define __RB_LOAD(x, mo)        (x).load(std::memory_order_##mo)
+#define __RB_STORE(x, v, mo)    (x).store((v), std::memory_order_##mo)
+#define __RB_CAS(x, e, v, mo)   (x).compare_exchange_weak(*(e), (v), std::memory_order_##mo, std::memory_order_relaxed)
+#define __RB_ADD(x, v, mo)      (x).fetch_add((v), std::memory_order_##mo)
+#define __RB_FENCE(mo)          std::atomic_thread_fence(std::memory_order_##mo)
+#else
+typedef _Atomic int32_t rb_index_t;
+#define __RB_LOAD(x, mo)        atomic_load_explicit(&(x), memory_order_##mo)
+#define __RB_STORE(x, v, mo)    atomic_store_explicit(&(x), (v), memory_order_##mo)
+#define __RB_CAS(x, e, v, mo)   atomic_compare_exchange_weak_explicit(&(x), (e), (v), memory_order_##mo, memory_order_relaxed)
+#define __RB_ADD(x, v, mo)      atomic_fetch_add_explicit(&(x), (v), memory_order_##mo)
+#define __RB_FENCE(mo)          atomic_thread_fence(memory_order_##mo)
+#endif
 
 
 /**
- * Ring-buffer that stores up to 'n-1' items, and is concurrency-safe.
+ * Ring-buffer that stores up to 'n-1' items, and is lock-free, and safe for a
+ * single producer and a single consumer (SPSC), on different threads or cores.
  *
  * Note(s):
+ *  - only the producer writes 'head', and only the consumer writes 'tail';
+ *  - each side loads its own index "relaxed", and the other side's index with
+ *    "acquire", and then publishes its new index with "release", so that the
+ *    element(s) are visible before the index that covers them;
  *  - if 'rb_clear(rb);' is called while a 'rb_pop(rb, val)' is in progress (for
  *    example, from an interrupt service routine), then this call may have no
  *    effect;
@@ -18,20 +51,71 @@
  *  - total size is 16 bytes (struct) + 'sizeof(x)*size' bytes (buffer);
  */
 typedef struct {
-    int32_t head;
-    int32_t tail;
+    rb_index_t head;
+    rb_index_t tail;
     int32_t wrap;
     void* data;
 } ringbuf_t;
 
 
+// Record framing, for byte ring-buffers: each record is a 4-byte length, and
+// then the payload, padded to a multiple of 4 bytes, and a record that won't
+// fit before the end of the buffer is preceded by a "pad" marker, so that every
+// record is contiguous.
+#define RB_RECORD_PAD       ((uint32_t)0xFFFFFFFF)
+#define RB_RECORD_NONE      (-1)
+#define RB_RECORD_TOO_BIG   (-2)
+#define RB_RECORD_BYTES(len) (4 + (((len) + 3) & ~3))
+
+
+// Cache-line size, for the padded ring-buffer
+#ifndef RB_CACHE_LINE
+#define RB_CACHE_LINE 64
+#endif
+
+/**
+ * One side (producer or consumer) of a padded ring-buffer, which holds its own
+ * index, a cached copy of the other side's index, and copies of 'wrap' and
+ * 'data', all on its own cache-line.
+ */
+typedef struct {
+    rb_index_t index;
+    int32_t cache;
+    int32_t wrap;
+    void* data;
+} __attribute__((aligned(RB_CACHE_LINE))) rbpad_side_t;
+
+/**
+ * Padded SPSC ring-buffer, that stores up to 'n-1' items, where the producer's
+ * and consumer's indices are on separate cache-lines, so that a push and a pop
+ * (on different cores) do not contend for the same line.
+ *
+ * Note(s):
+ *  - each side only loads the other side's index (which pulls in the other
+ *    side's cache-line) when its cached copy says that the buffer is full (for
+ *    the producer), or empty (for the consumer);
+ *  - the memory should be aligned to 'RB_CACHE_LINE' bytes (for example, from
+ *    'aligned_alloc(..)'), otherwise the sides may still share a line;
+ *  - the data-structure size is '2*RB_CACHE_LINE' bytes, followed by the
+ *    'sizeof(x)*size' bytes (buffer);
+ *  - same restrictions as 'ringbuf_t', so 'size' must be a power of two, and
+ *    buffer-clearing should be done from the "pop" thread;
+ */
+typedef struct {
+    rbpad_side_t prod;
+    rbpad_side_t cons;
+} rbpad_t;
+
+
 // -- Private macros -- //
 
 #define __RB_PUSH(rb, typ, elem)                \
-    if (rb_count(rb) < rb->wrap)                \
+    int32_t head = __RB_LOAD(rb->head, relaxed);\
+    int32_t tail = __RB_LOAD(rb->tail, acquire);\
+    if (((head - tail) & rb->wrap) < rb->wrap)  \
     {                                           \
-        ((typ*)rb->data)[rb->head++] = elem;    \
-        rb->head &= rb->wrap;                   \
+        ((typ*)rb->data)[head++] = elem;        \
+        __RB_STORE(rb->head, head & rb->wrap, release); \
         return 1;                               \
     }                                           \
     else                                        \
@@ -44,11 +128,11 @@ typedef struct {
 //   (immediately) result in a buffer-overflow -- as would be the case if we set
 //   to 'tail = (tail = head)++', which indicates "full."
 #define __RB_POP(rb, typ, elem)                 \
-    int32_t tail = rb->tail;                    \
-    if (tail != rb->head)                       \
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);\
+    if (tail != __RB_LOAD(rb->head, acquire))   \
     {                                           \
         *elem = ((typ*)rb->data)[tail++];       \
-        rb->tail = tail & rb->wrap;             \
+        __RB_STORE(rb->tail, tail & rb->wrap, release); \
         return 1;                               \
     }                                           \
     else                                        \
@@ -57,18 +141,183 @@ typedef struct {
     }
 
 
+// Note: moves up to 'n' elements, with at most two copies (if the elements wrap
+//   around the end of the buffer), and publishes the index once.
+#define __RB_PUSH_N(rb, typ, src, n)                    \
+    int32_t head = __RB_LOAD(rb->head, relaxed);        \
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap); \
+    int32_t first = rb->wrap - head + 1;                \
+    typ* data = (typ*)rb->data;                         \
+    if (count > n)                                      \
+    {                                                   \
+        count = n;                                      \
+    }                                                   \
+    if (count > first)                                  \
+    {                                                   \
+        memcpy(data + head, src, first * sizeof(typ));  \
+        memcpy(data, src + first, (count - first) * sizeof(typ)); \
+    }                                                   \
+    else                                                \
+    {                                                   \
+        memcpy(data + head, src, count * sizeof(typ));  \
+    }                                                   \
+    __RB_STORE(rb->head, (head + count) & rb->wrap, release); \
+    return count;
+
+#define __RB_POP_N(rb, typ, dst, n)                     \
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);        \
+    int32_t count = (__RB_LOAD(rb->head, acquire) - tail) & rb->wrap; \
+    int32_t first = rb->wrap - tail + 1;                \
+    const typ* data = (const typ*)rb->data;             \
+    if (count > n)                                      \
+    {                                                   \
+        count = n;                                      \
+    }                                                   \
+    if (count > first)                                  \
+    {                                                   \
+        memcpy(dst, data + tail, first * sizeof(typ));  \
+        memcpy(dst + first, data, (count - first) * sizeof(typ)); \
+    }                                                   \
+    else                                                \
+    {                                                   \
+        memcpy(dst, data + tail, count * sizeof(typ));  \
+    }                                                   \
+    __RB_STORE(rb->tail, (tail + count) & rb->wrap, release); \
+    return count;
+
+// Index difference, modulo the buffer size, in unsigned arithmetic, since the
+// free-running 'tail' (below) can be anywhere in the 'int32_t' range.
+#define __RB_DIFF(a, b, wrap)   ((int32_t)(((uint32_t)(a) - (uint32_t)(b)) & (uint32_t)(wrap)))
+
+// Note: in "overwrite" mode, 'tail' is a free-running counter (and the slot is
+//   'tail & wrap'), which is advanced with a CAS by both sides, so that its
+//   upper bits act as a version number, and a pop that raced with a drop (and
+//   so may have copied an item while it was being overwritten) is retried.
+#define __RB_PUSH_OVER(rb, typ, elem, dropped)          \
+    int32_t head = __RB_LOAD(rb->head, relaxed);        \
+    int32_t tail = __RB_LOAD(rb->tail, acquire);        \
+    int drop = 0;                                       \
+    while (__RB_DIFF(head, tail, rb->wrap) == rb->wrap) \
+    {                                                   \
+        if (__RB_CAS(rb->tail, &tail, (int32_t)((uint32_t)tail + 1), acq_rel)) \
+        {                                               \
+            drop = 1;                                   \
+            break;                                      \
+        }                                               \
+    }                                                   \
+    ((typ*)rb->data)[head] = elem;                      \
+    __RB_STORE(rb->head, (head + 1) & rb->wrap, release); \
+    if (dropped != NULL)                                \
+    {                                                   \
+        *dropped += drop;                               \
+    }                                                   \
+    return drop;
+
+// Note: as for a seqlock reader, the slot is copied (racily) into a local, and
+//   only kept if the CAS then finds 'tail' unchanged, which means no push
+//   dropped it meanwhile, so the copy wasn't torn. The CAS is a release, so the
+//   copy can't be reordered after it, and '*elem' is never left holding a
+//   discarded copy.
+#define __RB_POP_CHECKED(rb, typ, elem)                 \
+    int32_t tail = __RB_LOAD(rb->tail, acquire);        \
+    typ v;                                              \
+    for (;;)                                            \
+    {                                                   \
+        if (__RB_DIFF(__RB_LOAD(rb->head, acquire), tail, rb->wrap) == 0) \
+        {                                               \
+            return 0;                                   \
+        }                                               \
+        memcpy(&v, (const typ*)rb->data + (tail & rb->wrap), sizeof(typ)); \
+        if (__RB_CAS(rb->tail, &tail, (int32_t)((uint32_t)tail + 1), acq_rel)) \
+        {                                               \
+            *elem = v;                                  \
+            return 1;                                   \
+        }                                               \
+    }
+
+// Note: the cached index is refreshed only when the buffer looks full (or
+//   empty), which is rare, unless the other side is (nearly) keeping pace.
+#define __RBP_PUSH(rb, typ, elem)                       \
+    int32_t head = __RB_LOAD(rb->prod.index, relaxed);  \
+    int32_t next = (head + 1) & rb->prod.wrap;          \
+    if (next == rb->prod.cache)                         \
+    {                                                   \
+        rb->prod.cache = __RB_LOAD(rb->cons.index, acquire); \
+        if (next == rb->prod.cache)                     \
+        {                                               \
+            return 0;                                   \
+        }                                               \
+    }                                                   \
+    ((typ*)rb->prod.data)[head] = elem;                 \
+    __RB_STORE(rb->prod.index, next, release);          \
+    return 1;
+
+#define __RBP_POP(rb, typ, elem)                        \
+    int32_t tail = __RB_LOAD(rb->cons.index, relaxed);  \
+    if (tail == rb->cons.cache)                         \
+    {                                                   \
+        rb->cons.cache = __RB_LOAD(rb->prod.index, acquire); \
+        if (tail == rb->cons.cache)                     \
+        {                                               \
+            return 0;                                   \
+        }                                               \
+    }                                                   \
+    *elem = ((typ*)rb->cons.data)[tail];                \
+    __RB_STORE(rb->cons.index, (tail + 1) & rb->cons.wrap, release); \
+    return 1;
+
+
 // -- User macros -- //
 
+// Note: these also make 'rb_push_n(..)' and 'rb_pop_n(..)', which move up to
+//   'n' elements, and return the number moved.
 #define RB_MAKE_PUSH(typ)                               \
     static inline int rb_push(ringbuf_t* rb, typ x)     \
     {                                                   \
         __RB_PUSH(rb, typ, x);                          \
+    }                                                   \
+    static inline int32_t rb_push_n(ringbuf_t* rb, const typ* src, int32_t n) \
+    {                                                   \
+        __RB_PUSH_N(rb, typ, src, n);                   \
     }
 
 #define RB_MAKE_POP(typ)                                \
     static inline int rb_pop(ringbuf_t* rb, typ* p)     \
     {                                                   \
         __RB_POP(rb, typ, p);                           \
+    }                                                   \
+    static inline int32_t rb_pop_n(ringbuf_t* rb, typ* dst, int32_t n) \
+    {                                                   \
+        __RB_POP_N(rb, typ, dst, n);                    \
+    }
+
+// Note: "overwrite" mode keeps the newest items, by dropping the oldest when the
+//   buffer is full, so 'rb_push_over(..)' never fails, and returns the number
+//   of items dropped (also added to '*dropped', if not NULL). Such a buffer must
+//   be read with 'rb_pop_checked(..)' (and not 'rb_pop(..)', 'rb_take(..)', or
+//   'rb_drop(..)', which don't expect the producer to move 'tail').
+#define RB_MAKE_PUSH_OVERWRITE(typ)                     \
+    static inline int rb_push_over(ringbuf_t* rb, typ x, uint32_t* dropped) \
+    {                                                   \
+        __RB_PUSH_OVER(rb, typ, x, dropped);            \
+    }
+
+#define RB_MAKE_POP_CHECKED(typ)                        \
+    static inline int rb_pop_checked(ringbuf_t* rb, typ* p) \
+    {                                                   \
+        __RB_POP_CHECKED(rb, typ, p);                   \
+    }
+
+#define RBP_MAKE_PUSH(typ)                              \
+    static inline int rbp_push(rbpad_t* rb, typ x)      \
+    {                                                   \
+        __RBP_PUSH(rb, typ, x);                         \
+    }
+
+#define RBP_MAKE_POP(typ)                               \
+    static inline int rbp_pop(rbpad_t* rb, typ* p)      \
+    {                                                   \
+        __RBP_POP(rb, typ, p);                          \
     }
 
 
@@ -76,7 +325,7 @@ typedef struct {
 
 static inline int32_t rb_count(ringbuf_t* rb)
     {
-    return (rb->head - rb->tail) & rb->wrap;
+    return __RB_DIFF(__RB_LOAD(rb->head, acquire), __RB_LOAD(rb->tail, acquire), rb->wrap);
     }
 
 static inline int32_t rb_space(ringbuf_t* rb)
@@ -84,6 +333,16 @@ static inline int32_t rb_space(ringbuf_t* rb)
     return rb->wrap - rb_count(rb);
     }
 
+static inline int32_t rbp_count(rbpad_t* rb)
+    {
+    return (__RB_LOAD(rb->prod.index, acquire) - __RB_LOAD(rb->cons.index, acquire)) & rb->cons.wrap;
+    }
+
+static inline int32_t rbp_space(rbpad_t* rb)
+    {
+    return rb->prod.wrap - rbp_count(rb);
+    }
+
 
 // -- External user functions -- //
 
@@ -100,10 +359,38 @@ extern "C"
     int32_t rb_take(ringbuf_t* rb, uint8_t* dst, int32_t len);
     int32_t rb_drop(ringbuf_t* rb, int32_t len);
 
+    int32_t rb_reserve(ringbuf_t* rb, uint8_t** ptr, int32_t want);
+    int32_t rb_commit(ringbuf_t* rb, int32_t len);
+    int32_t rb_peek(ringbuf_t* rb, const uint8_t** ptr);
+    int32_t rb_consume(ringbuf_t* rb, int32_t len);
+
+    int32_t rb_put_record(ringbuf_t* rb, const uint8_t* src, int32_t len);
+    int32_t rb_get_record(ringbuf_t* rb, uint8_t* dst, int32_t max);
+    int32_t rb_peek_record(ringbuf_t* rb, const uint8_t** ptr);
+    int32_t rb_drop_record(ringbuf_t* rb);
+
     int rb_acquire(ringbuf_t* rb, int32_t* index);
     int rb_current(ringbuf_t* rb, int32_t* index);
     int rb_release(ringbuf_t* rb);
 
+#ifdef __linux__
+    /*
+     * Mirrored (double-mapped) byte ring-buffers, from src/ringbuf_mirror.c,
+     * where the mirror is opt-in, through 'rbm_copy(..)' and 'rbm_take(..)'.
+     */
+    ringbuf_t* rb_mirror_create(int32_t size);
+    void rb_mirror_destroy(ringbuf_t* rb);
+
+    int32_t rbm_copy(ringbuf_t* rb, const uint8_t* src, int32_t len);
+    int32_t rbm_take(ringbuf_t* rb, uint8_t* dst, int32_t len);
+#endif
+
+    rbpad_t* rbp_create(void* rb_ptr, int32_t size);
+    void rbp_clear(rbpad_t* rb);
+
+    int32_t rbp_copy(rbpad_t* rb, const uint8_t* src, int32_t len);
+    int32_t rbp_take(rbpad_t* rb, uint8_t* dst, int32_t len);
+
 #ifdef __cplusplus
     }
 #endif
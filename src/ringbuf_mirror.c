@@ -0,0 +1,134 @@
+/*
+ * File:    src/ringbuf_mirror.c
+ *
+ * Description
+ * -----------
+ * The source file src/ringbuf_mirror.c creates "mirrored" byte ring-buffers,
+ * where the data region is mapped twice, back to back, in virtual memory, so
+ * that a read or write that runs past the end of the buffer continues, in the
+ * second mapping, at the start of the buffer. Copies in and out are then one
+ * 'memcpy(..)' each, with no wrap handling. It requires Linux ('memfd_create'
+ * and 'mmap'), and so is kept apart from src/ringbuf.c, which is also built for
+ * bare-metal targets.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "ringbuf.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+/**
+ * Creates a mirrored byte ring-buffer, that stores up to 'size-1' bytes, and
+ * returns NULL on failure.
+ *
+ * Note(s):
+ *  - 'size' must be a power of two, and a multiple of the page size;
+ *  - the usual 'rb_..' functions can be used (and still split copies at the
+ *    wrap), and the mirror is only used by the wrap-free 'rbm_..' versions;
+ *  - the compiler assumes that 'data[i]' and 'data[i + size]' don't alias, so
+ *    don't access both, directly, within one function;
+ *  - free with 'rb_mirror_destroy(..)';
+ */
+ringbuf_t* rb_mirror_create(int32_t size)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    ringbuf_t* rb;
+    uint8_t* base;
+    int fd;
+
+    if (size <= 0 || (size & (size - 1)) != 0 || page <= 0 || (size % page) != 0) {
+        return NULL;
+    }
+    if ((rb = (ringbuf_t*)malloc(sizeof(ringbuf_t))) == NULL) {
+        return NULL;
+    }
+    if ((fd = memfd_create("ringbuf", MFD_CLOEXEC)) < 0) {
+        goto fail_free;
+    }
+    if (ftruncate(fd, size) != 0) {
+        goto fail_close;
+    }
+
+    // Reserve twice the address space, and then map the buffer into both halves
+    base = (uint8_t*)mmap(NULL, 2 * (size_t)size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        goto fail_close;
+    }
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, 2 * (size_t)size);
+        goto fail_close;
+    }
+    close(fd);
+
+    rb->wrap = size - 1;
+    __RB_STORE(rb->head, 0, relaxed);
+    __RB_STORE(rb->tail, 0, relaxed);
+    rb->data = base;
+
+    return rb;
+
+fail_close:
+    close(fd);
+fail_free:
+    free(rb);
+    return NULL;
+}
+
+/**
+ * Unmaps, and frees, a mirrored ring-buffer.
+ */
+void rb_mirror_destroy(ringbuf_t* rb)
+{
+    if (rb != NULL) {
+        munmap(rb->data, 2 * (size_t)(rb->wrap + 1));
+        free(rb);
+    }
+}
+
+/**
+ * Wrap-free version of 'rb_copy(..)', for mirrored ring-buffers only.
+ */
+int32_t rbm_copy(ringbuf_t* rb, const uint8_t* src, int32_t len)
+{
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t count = rb->wrap - ((head - __RB_LOAD(rb->tail, acquire)) & rb->wrap);
+
+    if (count < len) {
+        // Partial fill
+        len = count;
+    }
+    memcpy((uint8_t*)rb->data + head, src, len);
+
+    __RB_STORE(rb->head, (head + len) & rb->wrap, release);
+    return len;
+}
+
+/**
+ * Wrap-free version of 'rb_take(..)', for mirrored ring-buffers only.
+ */
+int32_t rbm_take(ringbuf_t* rb, uint8_t* dst, int32_t len)
+{
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t count = (__RB_LOAD(rb->head, acquire) - tail) & rb->wrap;
+
+    if (count < len) {
+        // Partial take
+        len = count;
+    }
+    memcpy(dst, (const uint8_t*)rb->data + tail, len);
+
+    __RB_STORE(rb->tail, (tail + len) & rb->wrap, release);
+    return len;
+}
+
+#endif  /* __linux__ */
@@ -0,0 +1,98 @@
+/*
+ * File:    src/ringbuf_wait.c
+ *
+ * Description
+ * -----------
+ * The source file src/ringbuf_wait.c puts the producer or the consumer of a
+ * 'ringbuf_wait_t' to sleep, on a futex, until the other side moves its index.
+ * It requires Linux, and so is kept apart from src/ringbuf.c, which is also
+ * built for bare-metal targets.
+ */
+
+#include "ringbuf_wait.h"
+
+#ifdef __linux__
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+// -- Helper-functions -- //
+
+static inline void futex_wait(rb_index_t* addr, int32_t seen)
+{
+    syscall(SYS_futex, (int32_t*)addr, FUTEX_WAIT_PRIVATE, seen, NULL, NULL, 0);
+}
+
+/**
+ * Sleeps until the index at 'index' moves away from 'seen', unless 'ready' is
+ * already true, after registering as a sleeper (which must be visible before
+ * 'ready' is evaluated, hence the sequentially-consistent increment).
+ */
+#define RBW_SLEEP(waiters, index, seen, ready)  \
+    do {                                        \
+        __RB_ADD(waiters, 1, seq_cst);          \
+        if (!(ready)) {                         \
+            futex_wait(&(index), (seen));       \
+        }                                       \
+        __RB_ADD(waiters, -1, relaxed);         \
+    } while (0)
+
+
+// -- Exported functions -- //
+
+/**
+ * Initialises a blocking ring-buffer, of 'size' items, where 'size' must be a
+ * power of two.
+ */
+ringbuf_wait_t* rbw_create(void* rb_ptr, int32_t size)
+{
+    ringbuf_wait_t* rw = (ringbuf_wait_t*) rb_ptr;
+
+    rb_create(&rw->rb, size);
+    rw->rb.data = (uint8_t*)rb_ptr + sizeof(ringbuf_wait_t);
+    __RB_STORE(rw->push_waiters, 0, relaxed);
+    __RB_STORE(rw->pop_waiters, 0, relaxed);
+
+    return rw;
+}
+
+/**
+ * Called by the producer, when the buffer is full, and returns once the tail
+ * has moved (or on a spurious wake-up).
+ */
+void rbw_wait_space(ringbuf_wait_t* rw)
+{
+    ringbuf_t* rb = &rw->rb;
+    int32_t head = __RB_LOAD(rb->head, relaxed);
+    int32_t tail = __RB_LOAD(rb->tail, acquire);
+
+    RBW_SLEEP(rw->push_waiters, rb->tail, tail,
+              ((head - __RB_LOAD(rb->tail, seq_cst)) & rb->wrap) != rb->wrap);
+}
+
+/**
+ * Called by the consumer, when the buffer is empty, and returns once the head
+ * has moved (or on a spurious wake-up).
+ */
+void rbw_wait_data(ringbuf_wait_t* rw)
+{
+    ringbuf_t* rb = &rw->rb;
+    int32_t tail = __RB_LOAD(rb->tail, relaxed);
+    int32_t head = __RB_LOAD(rb->head, acquire);
+
+    RBW_SLEEP(rw->pop_waiters, rb->head, head,
+              __RB_LOAD(rb->head, seq_cst) != tail);
+}
+
+/**
+ * Wakes all of the threads that are sleeping on 'index'.
+ */
+void rbw_wake(rb_index_t* index)
+{
+    syscall(SYS_futex, (int32_t*)index, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+#endif  /* __linux__ */
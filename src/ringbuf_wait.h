@@ -0,0 +1,138 @@
+#ifndef __RINGBUF_WAIT_H__
+#define __RINGBUF_WAIT_H__
+
+/**
+ * Blocking pushes and pops, for SPSC ring-buffers on Linux hosts, that spin for
+ * a while, and then sleep (on a futex), until the other side makes progress.
+ *
+ * Note(s):
+ *  - the futex is the other side's index, so no extra state is needed to see
+ *    whether a wake-up was missed -- the sleep is skipped if the index moved;
+ *  - each side counts its sleepers, and the other side only makes a 'futex'
+ *    system-call when that count is non-zero, so that a busy ring needs no
+ *    system-calls, and an idle one uses no CPU;
+ *  - the cost, on the fast path, is a full fence (to order the index update
+ *    before the read of the sleeper count), per push or pop;
+ *  - requires 'RB_MAKE_PUSH(typ)' and/or 'RB_MAKE_POP(typ)', before the
+ *    matching 'RB_MAKE_PUSH_WAIT(typ)' and/or 'RB_MAKE_POP_WAIT(typ)';
+ *  - the memory holds the 'ringbuf_wait_t', followed by the 'sizeof(x)*size'
+ *    bytes (buffer);
+ */
+
+#include "ringbuf.h"
+
+
+// -- Build-time configuration -- //
+
+// Number of retries (with a "pause" hint) before going to sleep.
+#ifndef RB_WAIT_SPINS
+#define RB_WAIT_SPINS 1024
+#endif
+
+
+// -- Data types -- //
+
+typedef struct {
+    ringbuf_t rb;
+    rb_index_t push_waiters;
+    rb_index_t pop_waiters;
+} ringbuf_wait_t;
+
+
+// -- Private macros -- //
+
+#if defined(__x86_64__) || defined(__i386__)
+#define __RB_PAUSE()    __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define __RB_PAUSE()    __asm__ __volatile__("yield")
+#else
+#define __RB_PAUSE()    ((void)0)
+#endif
+
+
+// -- User macros -- //
+
+#define RB_MAKE_PUSH_WAIT(typ)                                  \
+    static inline void rb_push_wait(ringbuf_wait_t* rw, typ x)  \
+    {                                                           \
+        for (int spin = RB_WAIT_SPINS; !rb_push(&rw->rb, x); )  \
+        {                                                       \
+            if (spin > 0)                                       \
+            {                                                   \
+                spin--;                                         \
+                __RB_PAUSE();                                   \
+            }                                                   \
+            else                                                \
+            {                                                   \
+                rbw_wait_space(rw);                             \
+            }                                                   \
+        }                                                       \
+        rbw_wake_pop(rw);                                       \
+    }
+
+#define RB_MAKE_POP_WAIT(typ)                                   \
+    static inline void rb_pop_wait(ringbuf_wait_t* rw, typ* p)  \
+    {                                                           \
+        for (int spin = RB_WAIT_SPINS; !rb_pop(&rw->rb, p); )   \
+        {                                                       \
+            if (spin > 0)                                       \
+            {                                                   \
+                spin--;                                         \
+                __RB_PAUSE();                                   \
+            }                                                   \
+            else                                                \
+            {                                                   \
+                rbw_wait_data(rw);                              \
+            }                                                   \
+        }                                                       \
+        rbw_wake_push(rw);                                      \
+    }
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+    ringbuf_wait_t* rbw_create(void* rb_ptr, int32_t size);
+
+    void rbw_wait_space(ringbuf_wait_t* rw);
+    void rbw_wait_data(ringbuf_wait_t* rw);
+    void rbw_wake(rb_index_t* index);
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+// -- Inlinable user functions -- //
+
+/**
+ * Wakes any sleeping consumer, after a push (or 'rb_copy(..)'), and is only a
+ * fence and a load, when there are none.
+ */
+static inline void rbw_wake_pop(ringbuf_wait_t* rw)
+    {
+    __RB_FENCE(seq_cst);
+    if (__RB_LOAD(rw->pop_waiters, relaxed) != 0)
+        {
+        rbw_wake(&rw->rb.head);
+        }
+    }
+
+/**
+ * Wakes any sleeping producer, after a pop (or 'rb_take(..)').
+ */
+static inline void rbw_wake_push(ringbuf_wait_t* rw)
+    {
+    __RB_FENCE(seq_cst);
+    if (__RB_LOAD(rw->push_waiters, relaxed) != 0)
+        {
+        rbw_wake(&rw->rb.tail);
+        }
+    }
+
+
+#endif /* __RINGBUF_WAIT_H__ */
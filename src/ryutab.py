@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Generator for the power-of-five tables, used by the shortest round-trip float
+formatters in 'strfmt_shortest.c' (after Ulf Adams' Ryu).
+
+Usage:
+  python3 ryutab.py > ryu_tab.h
+
+Note(s):
+ - this is a host tool, and is not part of the library;
+ - the generated header is committed, so that building the library does not
+   need Python;
+"""
+
+DOUBLE_POW5_INV_BITCOUNT = 125
+DOUBLE_POW5_BITCOUNT = 125
+DOUBLE_POW5_INV_TABLE_SIZE = 342
+DOUBLE_POW5_TABLE_SIZE = 326
+
+FLOAT_POW5_INV_BITCOUNT = 59
+FLOAT_POW5_BITCOUNT = 61
+FLOAT_POW5_INV_TABLE_SIZE = 31
+FLOAT_POW5_TABLE_SIZE = 47
+
+MASK64 = (1 << 64) - 1
+
+
+def pow5_inv(i, bitcount):
+    """ceil(2^j / 5^i), where 'j' makes the result 'bitcount' bits long."""
+    pow5 = 5 ** i
+    j = pow5.bit_length() - 1 + bitcount
+    return (1 << j) // pow5 + 1
+
+
+def pow5(i, bitcount):
+    """The top 'bitcount' bits of 5^i."""
+    p = 5 ** i
+    shift = p.bit_length() - bitcount
+    return p >> shift if shift >= 0 else p << -shift
+
+
+def emit64(name, values):
+    print("static const uint64_t %s[%d] = {" % (name, len(values)))
+    for v in values:
+        print("    %du," % v)
+    print("};\n")
+
+
+def emit128(name, values):
+    print("static const uint64_t %s[%d][2] = {" % (name, len(values)))
+    for v in values:
+        print("    { %du, %du }," % (v & MASK64, v >> 64))
+    print("};\n")
+
+
+def main():
+    print("/*\n"
+          " * File:    src/ryu_tab.h\n"
+          " *\n"
+          " * Generated by src/ryutab.py, do not edit.\n"
+          " *\n"
+          " * Description\n"
+          " * -----------\n"
+          " * Powers of five, and their (scaled) inverses, for the shortest round-trip\n"
+          " * float and double formatters. Each double entry is { low, high } 64 bits.\n"
+          " */\n")
+
+    print("#define FLOAT_POW5_INV_BITCOUNT  %d" % FLOAT_POW5_INV_BITCOUNT)
+    print("#define FLOAT_POW5_BITCOUNT      %d" % FLOAT_POW5_BITCOUNT)
+    print("#define DOUBLE_POW5_INV_BITCOUNT %d" % DOUBLE_POW5_INV_BITCOUNT)
+    print("#define DOUBLE_POW5_BITCOUNT     %d\n" % DOUBLE_POW5_BITCOUNT)
+
+    emit64("FLOAT_POW5_INV_SPLIT",
+           [pow5_inv(i, FLOAT_POW5_INV_BITCOUNT) for i in range(FLOAT_POW5_INV_TABLE_SIZE)])
+    emit64("FLOAT_POW5_SPLIT",
+           [pow5(i, FLOAT_POW5_BITCOUNT) for i in range(FLOAT_POW5_TABLE_SIZE)])
+    emit128("DOUBLE_POW5_INV_SPLIT",
+            [pow5_inv(i, DOUBLE_POW5_INV_BITCOUNT) for i in range(DOUBLE_POW5_INV_TABLE_SIZE)])
+    emit128("DOUBLE_POW5_SPLIT",
+            [pow5(i, DOUBLE_POW5_BITCOUNT) for i in range(DOUBLE_POW5_TABLE_SIZE)])
+
+
+if __name__ == "__main__":
+    main()
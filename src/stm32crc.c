@@ -35,44 +35,170 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(STM32CRC_NO_CLMUL)
+#include <immintrin.h>
+#define STM32CRC_HAVE_CLMUL
+#endif
+
+/*
+ * #define CRC32_CLMUL_MIN
+ *
+ * Below this length the set-up and final reduction of the carry-less multiply
+ * engine cost more than they save, so shorter inputs use the table engines.
+ */
+#define CRC32_CLMUL_MIN         64
+
+#if STM32CRC_SLICING != 1 && STM32CRC_SLICING != 8 && STM32CRC_SLICING != 16
+#error "STM32CRC_SLICING must be one of 1, 8, or 16"
+#endif
+
+/*
+ * For optimal speed, the CRC32 calculation uses tables with pre-calculated bit
+ * patterns which are used in the XOR operations in the program. These tables
+ * are generated at build time, by src/crctab.c, and are constant.
+ */
+#include "stm32crc_tab.h"
 
-static void             stm32crc_init(void);
 
-static bool             crc_tab32_init = false;
-static uint32_t         crc_tab32[256];
+static uint32_t         crc32_bytewise(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+#if STM32CRC_SLICING >= 8
+static uint32_t         crc32_slice8(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+#endif
+#if STM32CRC_SLICING >= 16
+static uint32_t         crc32_slice16(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+#endif
+static uint32_t         crc32_table(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+static uint32_t         crc32_update(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+static void             crc32_table_x4(uint32_t crc[4], const uint8_t *const ptr[4], size_t num_bytes);
+static void             crc32_multi4(const uint8_t *const ptrs[4], const size_t lens[4], uint32_t crcs[4]);
+
+static uint32_t         gf2_matrix_times(const uint32_t *mat, uint32_t vec);
+static void             gf2_matrix_square(uint32_t *square, const uint32_t *mat);
+
+#ifdef STM32CRC_HAVE_CLMUL
+static bool             crc32_has_clmul(void);
+static uint32_t         crc32_clmul(uint32_t crc, const uint8_t *ptr, size_t num_bytes);
+#endif
 
 
 /**
  * The function stm32crc_calc() calculates in one pass the common 32 bit CRC
  * value for a byte string that is passed to the function together with a
  * parameter indicating the length.
+ *
+ * On x86 processors that support carry-less multiplication, longer inputs use
+ * the PCLMULQDQ folding engine. Otherwise the table-driven engine selected, at
+ * build time, by STM32CRC_SLICING is used.
  */
 uint32_t stm32crc_calc(const uint8_t* input_str, size_t num_bytes)
     {
-    uint32_t crc;
-    uint32_t tmp;
-    uint32_t long_c;
-    const unsigned char *ptr;
-    size_t a;
+    if (input_str == NULL)
+        {
+        return CRC_START_32;
+        }
+
+    return crc32_update(CRC_START_32, input_str, num_bytes);
+    }
 
-    if (!crc_tab32_init)
+/**
+ * The function stm32crc_calc_bytewise() calculates the CRC-32 using the classic
+ * loop, which performs one table lookup per byte.
+ */
+uint32_t stm32crc_calc_bytewise(const uint8_t* input_str, size_t num_bytes)
+    {
+    if (input_str == NULL)
         {
-        stm32crc_init();
+        return CRC_START_32;
         }
 
-    crc = CRC_START_32;
-    ptr = input_str;
+    return crc32_bytewise(CRC_START_32, input_str, num_bytes);
+    }
 
-    if (ptr != NULL)
-        for (a = 0; a < num_bytes; a++)
-            {
-            long_c = 0x000000FFL & (uint32_t) *ptr;
-            tmp = (crc >> 24) ^ long_c;
-            crc = (crc << 8) ^ crc_tab32[tmp & 0xff];
-            ptr++;
-            }
+/**
+ * The function stm32crc_calc_slice8() calculates the CRC-32 eight bytes at a
+ * time, using eight 256-entry tables (8 kB). If the tables were not compiled
+ * in (STM32CRC_SLICING < 8), then the byte-at-a-time loop is used instead.
+ */
+uint32_t stm32crc_calc_slice8(const uint8_t* input_str, size_t num_bytes)
+    {
+    if (input_str == NULL)
+        {
+        return CRC_START_32;
+        }
 
-    return crc & 0xFFFFFFFFL;
+#if STM32CRC_SLICING >= 8
+    return crc32_slice8(CRC_START_32, input_str, num_bytes);
+#else
+    return crc32_table(CRC_START_32, input_str, num_bytes);
+#endif
+    }
+
+/**
+ * The function stm32crc_calc_slice16() calculates the CRC-32 sixteen bytes at a
+ * time, using sixteen 256-entry tables (16 kB). If the tables were not
+ * compiled in (STM32CRC_SLICING < 16), then the largest engine that was is used
+ * instead.
+ */
+uint32_t stm32crc_calc_slice16(const uint8_t* input_str, size_t num_bytes)
+    {
+    if (input_str == NULL)
+        {
+        return CRC_START_32;
+        }
+
+#if STM32CRC_SLICING >= 16
+    return crc32_slice16(CRC_START_32, input_str, num_bytes);
+#else
+    return crc32_table(CRC_START_32, input_str, num_bytes);
+#endif
+    }
+
+/**
+ * The function stm32crc_calc_clmul() calculates the CRC-32 by folding 64 bytes
+ * at a time with carry-less multiplications (x86 PCLMULQDQ). If the processor
+ * does not support them, then the table engine is used instead.
+ */
+uint32_t stm32crc_calc_clmul(const uint8_t* input_str, size_t num_bytes)
+    {
+    if (input_str == NULL)
+        {
+        return CRC_START_32;
+        }
+
+#ifdef STM32CRC_HAVE_CLMUL
+    if (num_bytes >= CRC32_CLMUL_MIN && crc32_has_clmul())
+        {
+        return crc32_clmul(CRC_START_32, input_str, num_bytes);
+        }
+#endif
+
+    return crc32_table(CRC_START_32, input_str, num_bytes);
+    }
+
+/**
+ * The function stm32crc_calc_multi() calculates the CRC-32 values of 'num'
+ * independent byte strings, such as a burst of USB packets, and stores them in
+ * 'crcs'. The strings are processed four at a time, with their table-lookup
+ * chains interleaved, so that the latency of each step is hidden behind the
+ * other three.
+ *
+ * The carry-less multiply engine is already throughput-bound, with the calls
+ * for independent strings overlapping by themselves, so when it is available,
+ * and the strings are long enough, each string is simply handed to it.
+ */
+void stm32crc_calc_multi(const uint8_t *input_strs[], const size_t num_bytes[], uint32_t crcs[], size_t num)
+    {
+    size_t i;
+
+    for (i = 0; i + 4 <= num; i += 4)
+        {
+        crc32_multi4(&input_strs[i], &num_bytes[i], &crcs[i]);
+        }
+
+    for (; i < num; i++)
+        {
+        crcs[i] = stm32crc_calc(input_strs[i], num_bytes[i]);
+        }
     }
 
 /**
@@ -84,40 +210,419 @@ uint32_t stm32crc_next(uint32_t crc, uint8_t c)
     uint32_t tmp;
     uint32_t long_c;
 
-    if (!crc_tab32_init)
-        {
-        stm32crc_init();
-        }
-
     long_c = 0x000000FFL & (uint32_t) c;
     tmp = (crc >> 24) ^ long_c;
-    crc = (crc << 8) ^ crc_tab32[tmp & 0xff];
+    crc = (crc << 8) ^ crc_tab32[0][tmp & 0xff];
 
     return crc & 0xFFFFFFFFL;
     }
 
 /**
- * For optimal speed, the CRC32 calculation uses a table with pre-calculated
- * bit patterns which are used in the XOR operations in the program. This table
- * is generated once, the first time the CRC update routine is called.
+ * The function stm32crc_init() prepares a streaming CRC-32 context, which can
+ * then be given the data in as many pieces as is convenient, of any length.
  */
-static void stm32crc_init(void)
+void stm32crc_init(stm32crc_ctx *ctx)
     {
-    uint32_t i;
-    uint32_t j;
+    ctx->crc = CRC_START_32;
+    }
+
+/**
+ * The function stm32crc_update() adds the next 'num_bytes' of the data to the
+ * context, using the same (bulk) engine as stm32crc_calc().
+ */
+void stm32crc_update(stm32crc_ctx *ctx, const uint8_t* input_str, size_t num_bytes)
+    {
+    if (input_str != NULL)
+        {
+        ctx->crc = crc32_update(ctx->crc, input_str, num_bytes);
+        }
+    }
+
+/**
+ * The function stm32crc_final() returns the CRC-32 value of all of the data
+ * that has been given to the context, which remains valid for further updates.
+ */
+uint32_t stm32crc_final(const stm32crc_ctx *ctx)
+    {
+    return ctx->crc;
+    }
+
+/**
+ * The function stm32crc_combine() calculates the CRC-32 of the concatenation of
+ * two byte strings, A and B, given only their individual CRCs and the length of
+ * B. Since the CRC is linear, and both CRCs start from CRC_START_32:
+ *
+ *   crc(AB) = crc(B) ^ (crc(A) ^ CRC_START_32).x^(8.lenB) mod P(x)
+ *
+ * The multiplication by x^(8.lenB) is performed by applying the "append a zero
+ * byte" operator, as a 32x32 GF(2) matrix, repeatedly squared so that only
+ * O(log(lenB)) matrix operations are required.
+ */
+uint32_t stm32crc_combine(uint32_t crc_a, uint32_t crc_b, size_t len_b)
+    {
+    uint32_t even[32];
+    uint32_t odd[32];
     uint32_t crc;
+    int n;
 
-    for (i = 0; i < 256; i++)
+    if (len_b == 0)
         {
-        crc = i << 24;
+        return crc_a;
+        }
+
+    // Operator for one zero bit, as columns: each bit moves up one place, and
+    // the top bit wraps around as the polynomial
+    for (n = 0; n < 31; n++)
+        {
+        odd[n] = (uint32_t) 1 << (n + 1);
+        }
+    odd[31] = CRC_POLY_32;
 
-        for (j = 0; j < 8; j++)
+    gf2_matrix_square(even, odd);       // Two zero bits
+    gf2_matrix_square(odd, even);       // Four zero bits
+
+    crc = crc_a ^ CRC_START_32;
+
+    // Apply 'len_b' zero bytes, the first square giving the one-byte operator
+    do
+        {
+        gf2_matrix_square(even, odd);
+        if (len_b & 1)
+            {
+            crc = gf2_matrix_times(even, crc);
+            }
+        len_b >>= 1;
+
+        if (len_b == 0)
+            {
+            break;
+            }
+
+        gf2_matrix_square(odd, even);
+        if (len_b & 1)
             {
-            crc = (crc << 1) ^ (((crc >> 31) & 0x01L) * CRC_POLY_32);
+            crc = gf2_matrix_times(odd, crc);
             }
+        len_b >>= 1;
+        }
+    while (len_b != 0);
+
+    return crc ^ crc_b;
+    }
+
+/**
+ * The function gf2_matrix_times() multiplies the 32x32 GF(2) matrix 'mat',
+ * stored as columns, by the vector 'vec'.
+ */
+static uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec)
+    {
+    uint32_t sum = 0;
 
-        crc_tab32[i] = crc;
+    while (vec)
+        {
+        if (vec & 1)
+            {
+            sum ^= *mat;
+            }
+        vec >>= 1;
+        mat++;
         }
 
-    crc_tab32_init = true;
+    return sum;
+    }
+
+/**
+ * The function gf2_matrix_square() sets 'square' to the product 'mat.mat'.
+ */
+static void gf2_matrix_square(uint32_t *square, const uint32_t *mat)
+    {
+    int n;
+
+    for (n = 0; n < 32; n++)
+        {
+        square[n] = gf2_matrix_times(mat, mat[n]);
+        }
     }
+
+/**
+ * The function crc32_bytewise() updates the CRC-32 value 'crc' with the given
+ * bytes, one table lookup per byte.
+ */
+static uint32_t crc32_bytewise(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+    while (num_bytes--)
+        {
+        crc = (crc << 8) ^ crc_tab32[0][(crc >> 24) ^ *ptr++];
+        }
+
+    return crc;
+    }
+
+#if STM32CRC_SLICING >= 8
+
+/**
+ * The function crc32_step8() updates the CRC-32 value 'crc' with one 8-byte
+ * block. It XORs the current CRC into the first (big-endian) word of the block,
+ * and then looks up every byte of the block in the table that accounts for the
+ * number of bytes that follow it.
+ */
+static inline uint32_t crc32_step8(uint32_t crc, const uint8_t *ptr)
+    {
+    uint32_t one;
+
+    one = crc ^ ((uint32_t) ptr[0] << 24 | (uint32_t) ptr[1] << 16 |
+                 (uint32_t) ptr[2] <<  8 | (uint32_t) ptr[3]);
+
+    return crc_tab32[7][one >> 24]          ^ crc_tab32[6][(one >> 16) & 0xff] ^
+           crc_tab32[5][(one >> 8) & 0xff]  ^ crc_tab32[4][one & 0xff]         ^
+           crc_tab32[3][ptr[4]]             ^ crc_tab32[2][ptr[5]]             ^
+           crc_tab32[1][ptr[6]]             ^ crc_tab32[0][ptr[7]];
+    }
+
+/**
+ * The function crc32_slice8() updates the CRC-32 value 'crc' with the given
+ * bytes, eight bytes per step.
+ */
+static uint32_t crc32_slice8(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+    while (num_bytes >= 8)
+        {
+        crc = crc32_step8(crc, ptr);
+
+        ptr       += 8;
+        num_bytes -= 8;
+        }
+
+    return crc32_bytewise(crc, ptr, num_bytes);
+    }
+
+#endif  // STM32CRC_SLICING >= 8
+
+#if STM32CRC_SLICING >= 16
+
+/**
+ * The function crc32_slice16() is the 16-byte version of crc32_slice8().
+ */
+static uint32_t crc32_slice16(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+    uint32_t one;
+
+    while (num_bytes >= 16)
+        {
+        one = crc ^ ((uint32_t) ptr[0] << 24 | (uint32_t) ptr[1] << 16 |
+                     (uint32_t) ptr[2] <<  8 | (uint32_t) ptr[3]);
+
+        crc = crc_tab32[15][one >> 24]         ^ crc_tab32[14][(one >> 16) & 0xff] ^
+              crc_tab32[13][(one >> 8) & 0xff] ^ crc_tab32[12][one & 0xff]         ^
+              crc_tab32[11][ptr[4]]            ^ crc_tab32[10][ptr[5]]             ^
+              crc_tab32[9][ptr[6]]             ^ crc_tab32[8][ptr[7]]              ^
+              crc_tab32[7][ptr[8]]             ^ crc_tab32[6][ptr[9]]              ^
+              crc_tab32[5][ptr[10]]            ^ crc_tab32[4][ptr[11]]             ^
+              crc_tab32[3][ptr[12]]            ^ crc_tab32[2][ptr[13]]             ^
+              crc_tab32[1][ptr[14]]            ^ crc_tab32[0][ptr[15]];
+
+        ptr       += 16;
+        num_bytes -= 16;
+        }
+
+    return crc32_slice8(crc, ptr, num_bytes);
+    }
+
+#endif  // STM32CRC_SLICING >= 16
+
+/**
+ * The function crc32_table() updates the CRC-32 value 'crc' with the given
+ * bytes, using the table engine selected by STM32CRC_SLICING.
+ */
+static uint32_t crc32_table(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+#if   STM32CRC_SLICING == 16
+    return crc32_slice16(crc, ptr, num_bytes);
+#elif STM32CRC_SLICING == 8
+    return crc32_slice8(crc, ptr, num_bytes);
+#else
+    return crc32_bytewise(crc, ptr, num_bytes);
+#endif
+    }
+
+/**
+ * The function crc32_table_x4() updates four CRC-32 values, each with the first
+ * 'num_bytes' of its own byte string, using the table engine.
+ */
+static void crc32_table_x4(uint32_t crc[4], const uint8_t *const ptr[4], size_t num_bytes)
+    {
+    uint32_t c0 = crc[0], c1 = crc[1], c2 = crc[2], c3 = crc[3];
+    size_t off = 0;
+
+#if STM32CRC_SLICING >= 8
+    for (; off + 8 <= num_bytes; off += 8)
+        {
+        c0 = crc32_step8(c0, ptr[0] + off);
+        c1 = crc32_step8(c1, ptr[1] + off);
+        c2 = crc32_step8(c2, ptr[2] + off);
+        c3 = crc32_step8(c3, ptr[3] + off);
+        }
+#endif
+
+    for (; off < num_bytes; off++)
+        {
+        c0 = (c0 << 8) ^ crc_tab32[0][(c0 >> 24) ^ ptr[0][off]];
+        c1 = (c1 << 8) ^ crc_tab32[0][(c1 >> 24) ^ ptr[1][off]];
+        c2 = (c2 << 8) ^ crc_tab32[0][(c2 >> 24) ^ ptr[2][off]];
+        c3 = (c3 << 8) ^ crc_tab32[0][(c3 >> 24) ^ ptr[3][off]];
+        }
+
+    crc[0] = c0;
+    crc[1] = c1;
+    crc[2] = c2;
+    crc[3] = c3;
+    }
+
+/**
+ * The function crc32_multi4() calculates four CRC-32 values, interleaved over
+ * the length of the shortest string, and then finishes each string on its own.
+ * A NULL string is treated as being empty.
+ */
+static void crc32_multi4(const uint8_t *const ptrs[4], const size_t lens[4], uint32_t crcs[4])
+    {
+    uint32_t crc[4];
+    size_t len[4];
+    size_t n;
+    int j;
+
+    n = (size_t) -1;
+    for (j = 0; j < 4; j++)
+        {
+        crc[j] = CRC_START_32;
+        len[j] = ptrs[j] != NULL ? lens[j] : 0;
+        n = len[j] < n ? len[j] : n;
+        }
+
+#ifdef STM32CRC_HAVE_CLMUL
+    if (n >= CRC32_CLMUL_MIN && crc32_has_clmul())
+        {
+        n = 0;
+        }
+#endif
+
+    crc32_table_x4(crc, ptrs, n);
+
+    for (j = 0; j < 4; j++)
+        {
+        crcs[j] = len[j] > n ? crc32_update(crc[j], ptrs[j] + n, len[j] - n) : crc[j];
+        }
+    }
+
+/**
+ * The function crc32_update() updates the CRC-32 value 'crc' with the given
+ * bytes, using the fastest engine that is available.
+ */
+static uint32_t crc32_update(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+#ifdef STM32CRC_HAVE_CLMUL
+    if (num_bytes >= CRC32_CLMUL_MIN && crc32_has_clmul())
+        {
+        return crc32_clmul(crc, ptr, num_bytes);
+        }
+#endif
+
+    return crc32_table(crc, ptr, num_bytes);
+    }
+
+#ifdef STM32CRC_HAVE_CLMUL
+
+/*
+ * Folding constants, x^k mod P(x), for the (non-reflected) polynomial
+ * 0x04C11DB7. Each 128-bit accumulator is split into 64-bit halves, with the
+ * upper half folded forward by (k + 64) bits, and the lower half by k bits.
+ */
+#define CRC32_X576              0x8833794CL
+#define CRC32_X512              0xE6228B11L
+#define CRC32_X192              0xC5B9CD4CL
+#define CRC32_X128              0xE8A45605L
+
+/**
+ * The CPUID checks are cached by libgcc, so this is just a couple of loads.
+ */
+static bool crc32_has_clmul(void)
+    {
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+    }
+
+/**
+ * The function crc32_fold() multiplies the accumulator 'acc' by x^k, modulo
+ * P(x), and then adds the next 16-byte block 'blk'. The result is congruent,
+ * but not reduced, which is fine until the very end.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static inline __m128i crc32_fold(__m128i acc, __m128i k, __m128i blk)
+    {
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), blk);
+    }
+
+/**
+ * The function crc32_clmul() updates the CRC-32 value 'crc' with at least 64
+ * bytes, which are loaded into four 128-bit accumulators and then folded 64
+ * bytes at a time. The accumulators are then folded into one, and folding
+ * continues 16 bytes at a time.
+ *
+ * Because the data is MSB-first, each (unaligned) load is byte-reversed so
+ * that bit 127 holds the coefficient of the highest power of x. The incoming
+ * CRC is added to the first 32 bits of the message, which is equivalent to
+ * starting from it.
+ *
+ * The final accumulator, 'A(x)', is congruent to the message, and so its CRC
+ * from zero, (A(x).x^32 mod P(x)), is the CRC of everything folded so far.
+ * This, and any tail of fewer than 16 bytes, use the table engine.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_clmul(uint32_t crc, const uint8_t *ptr, size_t num_bytes)
+    {
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k4 = _mm_set_epi64x(CRC32_X576, CRC32_X512);
+    const __m128i k1 = _mm_set_epi64x(CRC32_X192, CRC32_X128);
+    __m128i x0, x1, x2, x3;
+    uint8_t last[16];
+
+    x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr +  0)), bswap);
+    x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 16)), bswap);
+    x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 32)), bswap);
+    x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 48)), bswap);
+    x0 = _mm_xor_si128(x0, _mm_set_epi32((int) crc, 0, 0, 0));
+
+    ptr       += 64;
+    num_bytes -= 64;
+
+    while (num_bytes >= 64)
+        {
+        x0 = crc32_fold(x0, k4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr +  0)), bswap));
+        x1 = crc32_fold(x1, k4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 16)), bswap));
+        x2 = crc32_fold(x2, k4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 32)), bswap));
+        x3 = crc32_fold(x3, k4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (ptr + 48)), bswap));
+
+        ptr       += 64;
+        num_bytes -= 64;
+        }
+
+    x0 = crc32_fold(x0, k1, x1);
+    x0 = crc32_fold(x0, k1, x2);
+    x0 = crc32_fold(x0, k1, x3);
+
+    while (num_bytes >= 16)
+        {
+        x0 = crc32_fold(x0, k1, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) ptr), bswap));
+
+        ptr       += 16;
+        num_bytes -= 16;
+        }
+
+    _mm_storeu_si128((__m128i *) last, _mm_shuffle_epi8(x0, bswap));
+    crc = crc32_table(0, last, 16);
+
+    return crc32_table(crc, ptr, num_bytes);
+    }
+
+#endif  // STM32CRC_HAVE_CLMUL
@@ -55,11 +55,55 @@
  */
 #define         CRC_START_32            0xFFFFFFFFL
 
+/*
+ * #define STM32CRC_SLICING
+ *
+ * Selects the table-driven engine that is used by stm32crc_calc(). A value of
+ * 1 uses the classic byte-at-a-time loop (1 kB of tables), 8 or 16 use the
+ * slicing-by-8 (8 kB) or slicing-by-16 (16 kB) engines. The tables are const,
+ * and only those that are required are compiled in. The individual engines can
+ * also be selected at runtime, by calling them directly.
+ *
+ * On x86, stm32crc_calc() prefers the PCLMULQDQ engine, when the processor
+ * supports it, unless STM32CRC_NO_CLMUL is defined.
+ */
+#ifndef STM32CRC_SLICING
+#define         STM32CRC_SLICING        16
+#endif
+
+/*
+ * Streaming CRC-32 context, for data that arrives in pieces (for example, from
+ * USB or UART receive buffers). Use stm32crc_init(), then stm32crc_update() for
+ * each piece, and stm32crc_final() to get the CRC-32 value.
+ */
+typedef struct {
+    uint32_t crc;
+} stm32crc_ctx;
+
 /*
  * Prototype list of global functions
+ *
+ * The tables are generated at build time, so no initialisation is required,
+ * and all of these functions may be called concurrently, from multiple threads.
  */
 
 uint32_t stm32crc_calc(const unsigned char *input_str, size_t num_bytes);
+uint32_t stm32crc_calc_bytewise(const unsigned char *input_str, size_t num_bytes);
+uint32_t stm32crc_calc_slice8(const unsigned char *input_str, size_t num_bytes);
+uint32_t stm32crc_calc_slice16(const unsigned char *input_str, size_t num_bytes);
+uint32_t stm32crc_calc_clmul(const unsigned char *input_str, size_t num_bytes);
 uint32_t stm32crc_next(uint32_t crc, unsigned char c);
+void     stm32crc_calc_multi(const unsigned char *input_strs[], const size_t num_bytes[], uint32_t crcs[], size_t num);
+uint32_t stm32crc_combine(uint32_t crc_a, uint32_t crc_b, size_t len_b);
+
+void     stm32crc_init(stm32crc_ctx *ctx);
+void     stm32crc_update(stm32crc_ctx *ctx, const unsigned char *input_str, size_t num_bytes);
+uint32_t stm32crc_final(const stm32crc_ctx *ctx);
+
+/*
+ * Multi-threaded calculation, from src/stm32crc_mt.c, which requires POSIX
+ * threads. If 'num_threads' is zero, then one thread per online CPU is used.
+ */
+uint32_t stm32crc_calc_parallel(const unsigned char *input_str, size_t num_bytes, int num_threads);
 
 #endif  // DEF_LIBCRC_CHECKSUM_H
@@ -0,0 +1,115 @@
+/*
+ * File:    src/stm32crc_mt.c
+ *
+ * Description
+ * -----------
+ * The source file src/stm32crc_mt.c splits a large byte string into chunks,
+ * calculates their CRC-32 values on several threads, and then merges them with
+ * stm32crc_combine(). It requires POSIX threads, and so is kept apart from
+ * src/stm32crc.c, which is also built for bare-metal targets.
+ */
+
+#include "stm32crc.h"
+#include <pthread.h>
+#include <unistd.h>
+
+
+/*
+ * #define CRC_MT_MAX_THREADS
+ * #define CRC_MT_MIN_CHUNK
+ *
+ * Upper limit on the number of threads, and the smallest chunk that is worth
+ * handing to another thread.
+ */
+#define         CRC_MT_MAX_THREADS      64
+#define         CRC_MT_MIN_CHUNK        (256u * 1024u)
+
+
+typedef struct {
+    pthread_t           thread;
+    const uint8_t      *ptr;
+    size_t              len;
+    uint32_t            crc;
+    int                 started;
+} crc_chunk_t;
+
+
+static void *crc_chunk_worker(void *arg)
+    {
+    crc_chunk_t *chunk = (crc_chunk_t *) arg;
+
+    chunk->crc = stm32crc_calc(chunk->ptr, chunk->len);
+
+    return NULL;
+    }
+
+/**
+ * The function stm32crc_calc_parallel() calculates the same value as
+ * stm32crc_calc(), using up to 'num_threads' threads (including the calling
+ * thread). Inputs that are too short to split are handled by the calling
+ * thread, as are any chunks for which a thread could not be created.
+ */
+uint32_t stm32crc_calc_parallel(const uint8_t* input_str, size_t num_bytes, int num_threads)
+    {
+    crc_chunk_t chunks[CRC_MT_MAX_THREADS];
+    size_t step;
+    size_t off;
+    uint32_t crc;
+    int n;
+    int i;
+
+    if (num_threads <= 0)
+        {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int) cpus : 1;
+        }
+
+    if (num_threads > CRC_MT_MAX_THREADS)
+        {
+        num_threads = CRC_MT_MAX_THREADS;
+        }
+
+    if ((size_t) num_threads > num_bytes / CRC_MT_MIN_CHUNK)
+        {
+        num_threads = (int) (num_bytes / CRC_MT_MIN_CHUNK);
+        }
+
+    if (input_str == NULL || num_threads <= 1)
+        {
+        return stm32crc_calc(input_str, num_bytes);
+        }
+
+    n = num_threads;
+    step = (num_bytes / n + 63) & ~(size_t) 63;
+
+    for (i = 0, off = 0; i < n; i++, off += step)
+        {
+        chunks[i].ptr = input_str + off;
+        chunks[i].len = i == n - 1 ? num_bytes - off : step;
+        chunks[i].started = 0;
+        }
+
+    // Chunk 0 is calculated by the calling thread, while the others run
+    for (i = 1; i < n; i++)
+        {
+        chunks[i].started = pthread_create(&chunks[i].thread, NULL, crc_chunk_worker, &chunks[i]) == 0;
+        }
+
+    crc_chunk_worker(&chunks[0]);
+    crc = chunks[0].crc;
+
+    for (i = 1; i < n; i++)
+        {
+        if (chunks[i].started)
+            {
+            pthread_join(chunks[i].thread, NULL);
+            }
+        else
+            {
+            crc_chunk_worker(&chunks[i]);
+            }
+        crc = stm32crc_combine(crc, chunks[i].crc, chunks[i].len);
+        }
+
+    return crc;
+    }
@@ -0,0 +1,741 @@
+/*
+ * File:    src/stm32crc_tab.h
+ *
+ * Generated by src/crctab.c, do not edit.
+ *
+ * Description
+ * -----------
+ * Slicing tables for the (MSB-first) CRC-32 polynomial 0x04C11DB7, where
+ * 'crc_tab32[k][i]' is the CRC of the byte 'i' followed by 'k' zero bytes.
+ * Only the tables required by STM32CRC_SLICING are compiled in.
+ */
+
+static const uint32_t   crc_tab32[STM32CRC_SLICING][256] =
+    {
+        {
+        0x00000000L, 0x04C11DB7L, 0x09823B6EL, 0x0D4326D9L, 0x130476DCL, 0x17C56B6BL,
+        0x1A864DB2L, 0x1E475005L, 0x2608EDB8L, 0x22C9F00FL, 0x2F8AD6D6L, 0x2B4BCB61L,
+        0x350C9B64L, 0x31CD86D3L, 0x3C8EA00AL, 0x384FBDBDL, 0x4C11DB70L, 0x48D0C6C7L,
+        0x4593E01EL, 0x4152FDA9L, 0x5F15ADACL, 0x5BD4B01BL, 0x569796C2L, 0x52568B75L,
+        0x6A1936C8L, 0x6ED82B7FL, 0x639B0DA6L, 0x675A1011L, 0x791D4014L, 0x7DDC5DA3L,
+        0x709F7B7AL, 0x745E66CDL, 0x9823B6E0L, 0x9CE2AB57L, 0x91A18D8EL, 0x95609039L,
+        0x8B27C03CL, 0x8FE6DD8BL, 0x82A5FB52L, 0x8664E6E5L, 0xBE2B5B58L, 0xBAEA46EFL,
+        0xB7A96036L, 0xB3687D81L, 0xAD2F2D84L, 0xA9EE3033L, 0xA4AD16EAL, 0xA06C0B5DL,
+        0xD4326D90L, 0xD0F37027L, 0xDDB056FEL, 0xD9714B49L, 0xC7361B4CL, 0xC3F706FBL,
+        0xCEB42022L, 0xCA753D95L, 0xF23A8028L, 0xF6FB9D9FL, 0xFBB8BB46L, 0xFF79A6F1L,
+        0xE13EF6F4L, 0xE5FFEB43L, 0xE8BCCD9AL, 0xEC7DD02DL, 0x34867077L, 0x30476DC0L,
+        0x3D044B19L, 0x39C556AEL, 0x278206ABL, 0x23431B1CL, 0x2E003DC5L, 0x2AC12072L,
+        0x128E9DCFL, 0x164F8078L, 0x1B0CA6A1L, 0x1FCDBB16L, 0x018AEB13L, 0x054BF6A4L,
+        0x0808D07DL, 0x0CC9CDCAL, 0x7897AB07L, 0x7C56B6B0L, 0x71159069L, 0x75D48DDEL,
+        0x6B93DDDBL, 0x6F52C06CL, 0x6211E6B5L, 0x66D0FB02L, 0x5E9F46BFL, 0x5A5E5B08L,
+        0x571D7DD1L, 0x53DC6066L, 0x4D9B3063L, 0x495A2DD4L, 0x44190B0DL, 0x40D816BAL,
+        0xACA5C697L, 0xA864DB20L, 0xA527FDF9L, 0xA1E6E04EL, 0xBFA1B04BL, 0xBB60ADFCL,
+        0xB6238B25L, 0xB2E29692L, 0x8AAD2B2FL, 0x8E6C3698L, 0x832F1041L, 0x87EE0DF6L,
+        0x99A95DF3L, 0x9D684044L, 0x902B669DL, 0x94EA7B2AL, 0xE0B41DE7L, 0xE4750050L,
+        0xE9362689L, 0xEDF73B3EL, 0xF3B06B3BL, 0xF771768CL, 0xFA325055L, 0xFEF34DE2L,
+        0xC6BCF05FL, 0xC27DEDE8L, 0xCF3ECB31L, 0xCBFFD686L, 0xD5B88683L, 0xD1799B34L,
+        0xDC3ABDEDL, 0xD8FBA05AL, 0x690CE0EEL, 0x6DCDFD59L, 0x608EDB80L, 0x644FC637L,
+        0x7A089632L, 0x7EC98B85L, 0x738AAD5CL, 0x774BB0EBL, 0x4F040D56L, 0x4BC510E1L,
+        0x46863638L, 0x42472B8FL, 0x5C007B8AL, 0x58C1663DL, 0x558240E4L, 0x51435D53L,
+        0x251D3B9EL, 0x21DC2629L, 0x2C9F00F0L, 0x285E1D47L, 0x36194D42L, 0x32D850F5L,
+        0x3F9B762CL, 0x3B5A6B9BL, 0x0315D626L, 0x07D4CB91L, 0x0A97ED48L, 0x0E56F0FFL,
+        0x1011A0FAL, 0x14D0BD4DL, 0x19939B94L, 0x1D528623L, 0xF12F560EL, 0xF5EE4BB9L,
+        0xF8AD6D60L, 0xFC6C70D7L, 0xE22B20D2L, 0xE6EA3D65L, 0xEBA91BBCL, 0xEF68060BL,
+        0xD727BBB6L, 0xD3E6A601L, 0xDEA580D8L, 0xDA649D6FL, 0xC423CD6AL, 0xC0E2D0DDL,
+        0xCDA1F604L, 0xC960EBB3L, 0xBD3E8D7EL, 0xB9FF90C9L, 0xB4BCB610L, 0xB07DABA7L,
+        0xAE3AFBA2L, 0xAAFBE615L, 0xA7B8C0CCL, 0xA379DD7BL, 0x9B3660C6L, 0x9FF77D71L,
+        0x92B45BA8L, 0x9675461FL, 0x8832161AL, 0x8CF30BADL, 0x81B02D74L, 0x857130C3L,
+        0x5D8A9099L, 0x594B8D2EL, 0x5408ABF7L, 0x50C9B640L, 0x4E8EE645L, 0x4A4FFBF2L,
+        0x470CDD2BL, 0x43CDC09CL, 0x7B827D21L, 0x7F436096L, 0x7200464FL, 0x76C15BF8L,
+        0x68860BFDL, 0x6C47164AL, 0x61043093L, 0x65C52D24L, 0x119B4BE9L, 0x155A565EL,
+        0x18197087L, 0x1CD86D30L, 0x029F3D35L, 0x065E2082L, 0x0B1D065BL, 0x0FDC1BECL,
+        0x3793A651L, 0x3352BBE6L, 0x3E119D3FL, 0x3AD08088L, 0x2497D08DL, 0x2056CD3AL,
+        0x2D15EBE3L, 0x29D4F654L, 0xC5A92679L, 0xC1683BCEL, 0xCC2B1D17L, 0xC8EA00A0L,
+        0xD6AD50A5L, 0xD26C4D12L, 0xDF2F6BCBL, 0xDBEE767CL, 0xE3A1CBC1L, 0xE760D676L,
+        0xEA23F0AFL, 0xEEE2ED18L, 0xF0A5BD1DL, 0xF464A0AAL, 0xF9278673L, 0xFDE69BC4L,
+        0x89B8FD09L, 0x8D79E0BEL, 0x803AC667L, 0x84FBDBD0L, 0x9ABC8BD5L, 0x9E7D9662L,
+        0x933EB0BBL, 0x97FFAD0CL, 0xAFB010B1L, 0xAB710D06L, 0xA6322BDFL, 0xA2F33668L,
+        0xBCB4666DL, 0xB8757BDAL, 0xB5365D03L, 0xB1F740B4L
+        },
+
+#if STM32CRC_SLICING > 1
+        {
+        0x00000000L, 0xD219C1DCL, 0xA0F29E0FL, 0x72EB5FD3L, 0x452421A9L, 0x973DE075L,
+        0xE5D6BFA6L, 0x37CF7E7AL, 0x8A484352L, 0x5851828EL, 0x2ABADD5DL, 0xF8A31C81L,
+        0xCF6C62FBL, 0x1D75A327L, 0x6F9EFCF4L, 0xBD873D28L, 0x10519B13L, 0xC2485ACFL,
+        0xB0A3051CL, 0x62BAC4C0L, 0x5575BABAL, 0x876C7B66L, 0xF58724B5L, 0x279EE569L,
+        0x9A19D841L, 0x4800199DL, 0x3AEB464EL, 0xE8F28792L, 0xDF3DF9E8L, 0x0D243834L,
+        0x7FCF67E7L, 0xADD6A63BL, 0x20A33626L, 0xF2BAF7FAL, 0x8051A829L, 0x524869F5L,
+        0x6587178FL, 0xB79ED653L, 0xC5758980L, 0x176C485CL, 0xAAEB7574L, 0x78F2B4A8L,
+        0x0A19EB7BL, 0xD8002AA7L, 0xEFCF54DDL, 0x3DD69501L, 0x4F3DCAD2L, 0x9D240B0EL,
+        0x30F2AD35L, 0xE2EB6CE9L, 0x9000333AL, 0x4219F2E6L, 0x75D68C9CL, 0xA7CF4D40L,
+        0xD5241293L, 0x073DD34FL, 0xBABAEE67L, 0x68A32FBBL, 0x1A487068L, 0xC851B1B4L,
+        0xFF9ECFCEL, 0x2D870E12L, 0x5F6C51C1L, 0x8D75901DL, 0x41466C4CL, 0x935FAD90L,
+        0xE1B4F243L, 0x33AD339FL, 0x04624DE5L, 0xD67B8C39L, 0xA490D3EAL, 0x76891236L,
+        0xCB0E2F1EL, 0x1917EEC2L, 0x6BFCB111L, 0xB9E570CDL, 0x8E2A0EB7L, 0x5C33CF6BL,
+        0x2ED890B8L, 0xFCC15164L, 0x5117F75FL, 0x830E3683L, 0xF1E56950L, 0x23FCA88CL,
+        0x1433D6F6L, 0xC62A172AL, 0xB4C148F9L, 0x66D88925L, 0xDB5FB40DL, 0x094675D1L,
+        0x7BAD2A02L, 0xA9B4EBDEL, 0x9E7B95A4L, 0x4C625478L, 0x3E890BABL, 0xEC90CA77L,
+        0x61E55A6AL, 0xB3FC9BB6L, 0xC117C465L, 0x130E05B9L, 0x24C17BC3L, 0xF6D8BA1FL,
+        0x8433E5CCL, 0x562A2410L, 0xEBAD1938L, 0x39B4D8E4L, 0x4B5F8737L, 0x994646EBL,
+        0xAE893891L, 0x7C90F94DL, 0x0E7BA69EL, 0xDC626742L, 0x71B4C179L, 0xA3AD00A5L,
+        0xD1465F76L, 0x035F9EAAL, 0x3490E0D0L, 0xE689210CL, 0x94627EDFL, 0x467BBF03L,
+        0xFBFC822BL, 0x29E543F7L, 0x5B0E1C24L, 0x8917DDF8L, 0xBED8A382L, 0x6CC1625EL,
+        0x1E2A3D8DL, 0xCC33FC51L, 0x828CD898L, 0x50951944L, 0x227E4697L, 0xF067874BL,
+        0xC7A8F931L, 0x15B138EDL, 0x675A673EL, 0xB543A6E2L, 0x08C49BCAL, 0xDADD5A16L,
+        0xA83605C5L, 0x7A2FC419L, 0x4DE0BA63L, 0x9FF97BBFL, 0xED12246CL, 0x3F0BE5B0L,
+        0x92DD438BL, 0x40C48257L, 0x322FDD84L, 0xE0361C58L, 0xD7F96222L, 0x05E0A3FEL,
+        0x770BFC2DL, 0xA5123DF1L, 0x189500D9L, 0xCA8CC105L, 0xB8679ED6L, 0x6A7E5F0AL,
+        0x5DB12170L, 0x8FA8E0ACL, 0xFD43BF7FL, 0x2F5A7EA3L, 0xA22FEEBEL, 0x70362F62L,
+        0x02DD70B1L, 0xD0C4B16DL, 0xE70BCF17L, 0x35120ECBL, 0x47F95118L, 0x95E090C4L,
+        0x2867ADECL, 0xFA7E6C30L, 0x889533E3L, 0x5A8CF23FL, 0x6D438C45L, 0xBF5A4D99L,
+        0xCDB1124AL, 0x1FA8D396L, 0xB27E75ADL, 0x6067B471L, 0x128CEBA2L, 0xC0952A7EL,
+        0xF75A5404L, 0x254395D8L, 0x57A8CA0BL, 0x85B10BD7L, 0x383636FFL, 0xEA2FF723L,
+        0x98C4A8F0L, 0x4ADD692CL, 0x7D121756L, 0xAF0BD68AL, 0xDDE08959L, 0x0FF94885L,
+        0xC3CAB4D4L, 0x11D37508L, 0x63382ADBL, 0xB121EB07L, 0x86EE957DL, 0x54F754A1L,
+        0x261C0B72L, 0xF405CAAEL, 0x4982F786L, 0x9B9B365AL, 0xE9706989L, 0x3B69A855L,
+        0x0CA6D62FL, 0xDEBF17F3L, 0xAC544820L, 0x7E4D89FCL, 0xD39B2FC7L, 0x0182EE1BL,
+        0x7369B1C8L, 0xA1707014L, 0x96BF0E6EL, 0x44A6CFB2L, 0x364D9061L, 0xE45451BDL,
+        0x59D36C95L, 0x8BCAAD49L, 0xF921F29AL, 0x2B383346L, 0x1CF74D3CL, 0xCEEE8CE0L,
+        0xBC05D333L, 0x6E1C12EFL, 0xE36982F2L, 0x3170432EL, 0x439B1CFDL, 0x9182DD21L,
+        0xA64DA35BL, 0x74546287L, 0x06BF3D54L, 0xD4A6FC88L, 0x6921C1A0L, 0xBB38007CL,
+        0xC9D35FAFL, 0x1BCA9E73L, 0x2C05E009L, 0xFE1C21D5L, 0x8CF77E06L, 0x5EEEBFDAL,
+        0xF33819E1L, 0x2121D83DL, 0x53CA87EEL, 0x81D34632L, 0xB61C3848L, 0x6405F994L,
+        0x16EEA647L, 0xC4F7679BL, 0x79705AB3L, 0xAB699B6FL, 0xD982C4BCL, 0x0B9B0560L,
+        0x3C547B1AL, 0xEE4DBAC6L, 0x9CA6E515L, 0x4EBF24C9L
+        },
+        {
+        0x00000000L, 0x01D8AC87L, 0x03B1590EL, 0x0269F589L, 0x0762B21CL, 0x06BA1E9BL,
+        0x04D3EB12L, 0x050B4795L, 0x0EC56438L, 0x0F1DC8BFL, 0x0D743D36L, 0x0CAC91B1L,
+        0x09A7D624L, 0x087F7AA3L, 0x0A168F2AL, 0x0BCE23ADL, 0x1D8AC870L, 0x1C5264F7L,
+        0x1E3B917EL, 0x1FE33DF9L, 0x1AE87A6CL, 0x1B30D6EBL, 0x19592362L, 0x18818FE5L,
+        0x134FAC48L, 0x129700CFL, 0x10FEF546L, 0x112659C1L, 0x142D1E54L, 0x15F5B2D3L,
+        0x179C475AL, 0x1644EBDDL, 0x3B1590E0L, 0x3ACD3C67L, 0x38A4C9EEL, 0x397C6569L,
+        0x3C7722FCL, 0x3DAF8E7BL, 0x3FC67BF2L, 0x3E1ED775L, 0x35D0F4D8L, 0x3408585FL,
+        0x3661ADD6L, 0x37B90151L, 0x32B246C4L, 0x336AEA43L, 0x31031FCAL, 0x30DBB34DL,
+        0x269F5890L, 0x2747F417L, 0x252E019EL, 0x24F6AD19L, 0x21FDEA8CL, 0x2025460BL,
+        0x224CB382L, 0x23941F05L, 0x285A3CA8L, 0x2982902FL, 0x2BEB65A6L, 0x2A33C921L,
+        0x2F388EB4L, 0x2EE02233L, 0x2C89D7BAL, 0x2D517B3DL, 0x762B21C0L, 0x77F38D47L,
+        0x759A78CEL, 0x7442D449L, 0x714993DCL, 0x70913F5BL, 0x72F8CAD2L, 0x73206655L,
+        0x78EE45F8L, 0x7936E97FL, 0x7B5F1CF6L, 0x7A87B071L, 0x7F8CF7E4L, 0x7E545B63L,
+        0x7C3DAEEAL, 0x7DE5026DL, 0x6BA1E9B0L, 0x6A794537L, 0x6810B0BEL, 0x69C81C39L,
+        0x6CC35BACL, 0x6D1BF72BL, 0x6F7202A2L, 0x6EAAAE25L, 0x65648D88L, 0x64BC210FL,
+        0x66D5D486L, 0x670D7801L, 0x62063F94L, 0x63DE9313L, 0x61B7669AL, 0x606FCA1DL,
+        0x4D3EB120L, 0x4CE61DA7L, 0x4E8FE82EL, 0x4F5744A9L, 0x4A5C033CL, 0x4B84AFBBL,
+        0x49ED5A32L, 0x4835F6B5L, 0x43FBD518L, 0x4223799FL, 0x404A8C16L, 0x41922091L,
+        0x44996704L, 0x4541CB83L, 0x47283E0AL, 0x46F0928DL, 0x50B47950L, 0x516CD5D7L,
+        0x5305205EL, 0x52DD8CD9L, 0x57D6CB4CL, 0x560E67CBL, 0x54679242L, 0x55BF3EC5L,
+        0x5E711D68L, 0x5FA9B1EFL, 0x5DC04466L, 0x5C18E8E1L, 0x5913AF74L, 0x58CB03F3L,
+        0x5AA2F67AL, 0x5B7A5AFDL, 0xEC564380L, 0xED8EEF07L, 0xEFE71A8EL, 0xEE3FB609L,
+        0xEB34F19CL, 0xEAEC5D1BL, 0xE885A892L, 0xE95D0415L, 0xE29327B8L, 0xE34B8B3FL,
+        0xE1227EB6L, 0xE0FAD231L, 0xE5F195A4L, 0xE4293923L, 0xE640CCAAL, 0xE798602DL,
+        0xF1DC8BF0L, 0xF0042777L, 0xF26DD2FEL, 0xF3B57E79L, 0xF6BE39ECL, 0xF766956BL,
+        0xF50F60E2L, 0xF4D7CC65L, 0xFF19EFC8L, 0xFEC1434FL, 0xFCA8B6C6L, 0xFD701A41L,
+        0xF87B5DD4L, 0xF9A3F153L, 0xFBCA04DAL, 0xFA12A85DL, 0xD743D360L, 0xD69B7FE7L,
+        0xD4F28A6EL, 0xD52A26E9L, 0xD021617CL, 0xD1F9CDFBL, 0xD3903872L, 0xD24894F5L,
+        0xD986B758L, 0xD85E1BDFL, 0xDA37EE56L, 0xDBEF42D1L, 0xDEE40544L, 0xDF3CA9C3L,
+        0xDD555C4AL, 0xDC8DF0CDL, 0xCAC91B10L, 0xCB11B797L, 0xC978421EL, 0xC8A0EE99L,
+        0xCDABA90CL, 0xCC73058BL, 0xCE1AF002L, 0xCFC25C85L, 0xC40C7F28L, 0xC5D4D3AFL,
+        0xC7BD2626L, 0xC6658AA1L, 0xC36ECD34L, 0xC2B661B3L, 0xC0DF943AL, 0xC10738BDL,
+        0x9A7D6240L, 0x9BA5CEC7L, 0x99CC3B4EL, 0x981497C9L, 0x9D1FD05CL, 0x9CC77CDBL,
+        0x9EAE8952L, 0x9F7625D5L, 0x94B80678L, 0x9560AAFFL, 0x97095F76L, 0x96D1F3F1L,
+        0x93DAB464L, 0x920218E3L, 0x906BED6AL, 0x91B341EDL, 0x87F7AA30L, 0x862F06B7L,
+        0x8446F33EL, 0x859E5FB9L, 0x8095182CL, 0x814DB4ABL, 0x83244122L, 0x82FCEDA5L,
+        0x8932CE08L, 0x88EA628FL, 0x8A839706L, 0x8B5B3B81L, 0x8E507C14L, 0x8F88D093L,
+        0x8DE1251AL, 0x8C39899DL, 0xA168F2A0L, 0xA0B05E27L, 0xA2D9ABAEL, 0xA3010729L,
+        0xA60A40BCL, 0xA7D2EC3BL, 0xA5BB19B2L, 0xA463B535L, 0xAFAD9698L, 0xAE753A1FL,
+        0xAC1CCF96L, 0xADC46311L, 0xA8CF2484L, 0xA9178803L, 0xAB7E7D8AL, 0xAAA6D10DL,
+        0xBCE23AD0L, 0xBD3A9657L, 0xBF5363DEL, 0xBE8BCF59L, 0xBB8088CCL, 0xBA58244BL,
+        0xB831D1C2L, 0xB9E97D45L, 0xB2275EE8L, 0xB3FFF26FL, 0xB19607E6L, 0xB04EAB61L,
+        0xB545ECF4L, 0xB49D4073L, 0xB6F4B5FAL, 0xB72C197DL
+        },
+        {
+        0x00000000L, 0xDC6D9AB7L, 0xBC1A28D9L, 0x6077B26EL, 0x7CF54C05L, 0xA098D6B2L,
+        0xC0EF64DCL, 0x1C82FE6BL, 0xF9EA980AL, 0x258702BDL, 0x45F0B0D3L, 0x999D2A64L,
+        0x851FD40FL, 0x59724EB8L, 0x3905FCD6L, 0xE5686661L, 0xF7142DA3L, 0x2B79B714L,
+        0x4B0E057AL, 0x97639FCDL, 0x8BE161A6L, 0x578CFB11L, 0x37FB497FL, 0xEB96D3C8L,
+        0x0EFEB5A9L, 0xD2932F1EL, 0xB2E49D70L, 0x6E8907C7L, 0x720BF9ACL, 0xAE66631BL,
+        0xCE11D175L, 0x127C4BC2L, 0xEAE946F1L, 0x3684DC46L, 0x56F36E28L, 0x8A9EF49FL,
+        0x961C0AF4L, 0x4A719043L, 0x2A06222DL, 0xF66BB89AL, 0x1303DEFBL, 0xCF6E444CL,
+        0xAF19F622L, 0x73746C95L, 0x6FF692FEL, 0xB39B0849L, 0xD3ECBA27L, 0x0F812090L,
+        0x1DFD6B52L, 0xC190F1E5L, 0xA1E7438BL, 0x7D8AD93CL, 0x61082757L, 0xBD65BDE0L,
+        0xDD120F8EL, 0x017F9539L, 0xE417F358L, 0x387A69EFL, 0x580DDB81L, 0x84604136L,
+        0x98E2BF5DL, 0x448F25EAL, 0x24F89784L, 0xF8950D33L, 0xD1139055L, 0x0D7E0AE2L,
+        0x6D09B88CL, 0xB164223BL, 0xADE6DC50L, 0x718B46E7L, 0x11FCF489L, 0xCD916E3EL,
+        0x28F9085FL, 0xF49492E8L, 0x94E32086L, 0x488EBA31L, 0x540C445AL, 0x8861DEEDL,
+        0xE8166C83L, 0x347BF634L, 0x2607BDF6L, 0xFA6A2741L, 0x9A1D952FL, 0x46700F98L,
+        0x5AF2F1F3L, 0x869F6B44L, 0xE6E8D92AL, 0x3A85439DL, 0xDFED25FCL, 0x0380BF4BL,
+        0x63F70D25L, 0xBF9A9792L, 0xA31869F9L, 0x7F75F34EL, 0x1F024120L, 0xC36FDB97L,
+        0x3BFAD6A4L, 0xE7974C13L, 0x87E0FE7DL, 0x5B8D64CAL, 0x470F9AA1L, 0x9B620016L,
+        0xFB15B278L, 0x277828CFL, 0xC2104EAEL, 0x1E7DD419L, 0x7E0A6677L, 0xA267FCC0L,
+        0xBEE502ABL, 0x6288981CL, 0x02FF2A72L, 0xDE92B0C5L, 0xCCEEFB07L, 0x108361B0L,
+        0x70F4D3DEL, 0xAC994969L, 0xB01BB702L, 0x6C762DB5L, 0x0C019FDBL, 0xD06C056CL,
+        0x3504630DL, 0xE969F9BAL, 0x891E4BD4L, 0x5573D163L, 0x49F12F08L, 0x959CB5BFL,
+        0xF5EB07D1L, 0x29869D66L, 0xA6E63D1DL, 0x7A8BA7AAL, 0x1AFC15C4L, 0xC6918F73L,
+        0xDA137118L, 0x067EEBAFL, 0x660959C1L, 0xBA64C376L, 0x5F0CA517L, 0x83613FA0L,
+        0xE3168DCEL, 0x3F7B1779L, 0x23F9E912L, 0xFF9473A5L, 0x9FE3C1CBL, 0x438E5B7CL,
+        0x51F210BEL, 0x8D9F8A09L, 0xEDE83867L, 0x3185A2D0L, 0x2D075CBBL, 0xF16AC60CL,
+        0x911D7462L, 0x4D70EED5L, 0xA81888B4L, 0x74751203L, 0x1402A06DL, 0xC86F3ADAL,
+        0xD4EDC4B1L, 0x08805E06L, 0x68F7EC68L, 0xB49A76DFL, 0x4C0F7BECL, 0x9062E15BL,
+        0xF0155335L, 0x2C78C982L, 0x30FA37E9L, 0xEC97AD5EL, 0x8CE01F30L, 0x508D8587L,
+        0xB5E5E3E6L, 0x69887951L, 0x09FFCB3FL, 0xD5925188L, 0xC910AFE3L, 0x157D3554L,
+        0x750A873AL, 0xA9671D8DL, 0xBB1B564FL, 0x6776CCF8L, 0x07017E96L, 0xDB6CE421L,
+        0xC7EE1A4AL, 0x1B8380FDL, 0x7BF43293L, 0xA799A824L, 0x42F1CE45L, 0x9E9C54F2L,
+        0xFEEBE69CL, 0x22867C2BL, 0x3E048240L, 0xE26918F7L, 0x821EAA99L, 0x5E73302EL,
+        0x77F5AD48L, 0xAB9837FFL, 0xCBEF8591L, 0x17821F26L, 0x0B00E14DL, 0xD76D7BFAL,
+        0xB71AC994L, 0x6B775323L, 0x8E1F3542L, 0x5272AFF5L, 0x32051D9BL, 0xEE68872CL,
+        0xF2EA7947L, 0x2E87E3F0L, 0x4EF0519EL, 0x929DCB29L, 0x80E180EBL, 0x5C8C1A5CL,
+        0x3CFBA832L, 0xE0963285L, 0xFC14CCEEL, 0x20795659L, 0x400EE437L, 0x9C637E80L,
+        0x790B18E1L, 0xA5668256L, 0xC5113038L, 0x197CAA8FL, 0x05FE54E4L, 0xD993CE53L,
+        0xB9E47C3DL, 0x6589E68AL, 0x9D1CEBB9L, 0x4171710EL, 0x2106C360L, 0xFD6B59D7L,
+        0xE1E9A7BCL, 0x3D843D0BL, 0x5DF38F65L, 0x819E15D2L, 0x64F673B3L, 0xB89BE904L,
+        0xD8EC5B6AL, 0x0481C1DDL, 0x18033FB6L, 0xC46EA501L, 0xA419176FL, 0x78748DD8L,
+        0x6A08C61AL, 0xB6655CADL, 0xD612EEC3L, 0x0A7F7474L, 0x16FD8A1FL, 0xCA9010A8L,
+        0xAAE7A2C6L, 0x768A3871L, 0x93E25E10L, 0x4F8FC4A7L, 0x2FF876C9L, 0xF395EC7EL,
+        0xEF171215L, 0x337A88A2L, 0x530D3ACCL, 0x8F60A07BL
+        },
+        {
+        0x00000000L, 0x490D678DL, 0x921ACF1AL, 0xDB17A897L, 0x20F48383L, 0x69F9E40EL,
+        0xB2EE4C99L, 0xFBE32B14L, 0x41E90706L, 0x08E4608BL, 0xD3F3C81CL, 0x9AFEAF91L,
+        0x611D8485L, 0x2810E308L, 0xF3074B9FL, 0xBA0A2C12L, 0x83D20E0CL, 0xCADF6981L,
+        0x11C8C116L, 0x58C5A69BL, 0xA3268D8FL, 0xEA2BEA02L, 0x313C4295L, 0x78312518L,
+        0xC23B090AL, 0x8B366E87L, 0x5021C610L, 0x192CA19DL, 0xE2CF8A89L, 0xABC2ED04L,
+        0x70D54593L, 0x39D8221EL, 0x036501AFL, 0x4A686622L, 0x917FCEB5L, 0xD872A938L,
+        0x2391822CL, 0x6A9CE5A1L, 0xB18B4D36L, 0xF8862ABBL, 0x428C06A9L, 0x0B816124L,
+        0xD096C9B3L, 0x999BAE3EL, 0x6278852AL, 0x2B75E2A7L, 0xF0624A30L, 0xB96F2DBDL,
+        0x80B70FA3L, 0xC9BA682EL, 0x12ADC0B9L, 0x5BA0A734L, 0xA0438C20L, 0xE94EEBADL,
+        0x3259433AL, 0x7B5424B7L, 0xC15E08A5L, 0x88536F28L, 0x5344C7BFL, 0x1A49A032L,
+        0xE1AA8B26L, 0xA8A7ECABL, 0x73B0443CL, 0x3ABD23B1L, 0x06CA035EL, 0x4FC764D3L,
+        0x94D0CC44L, 0xDDDDABC9L, 0x263E80DDL, 0x6F33E750L, 0xB4244FC7L, 0xFD29284AL,
+        0x47230458L, 0x0E2E63D5L, 0xD539CB42L, 0x9C34ACCFL, 0x67D787DBL, 0x2EDAE056L,
+        0xF5CD48C1L, 0xBCC02F4CL, 0x85180D52L, 0xCC156ADFL, 0x1702C248L, 0x5E0FA5C5L,
+        0xA5EC8ED1L, 0xECE1E95CL, 0x37F641CBL, 0x7EFB2646L, 0xC4F10A54L, 0x8DFC6DD9L,
+        0x56EBC54EL, 0x1FE6A2C3L, 0xE40589D7L, 0xAD08EE5AL, 0x761F46CDL, 0x3F122140L,
+        0x05AF02F1L, 0x4CA2657CL, 0x97B5CDEBL, 0xDEB8AA66L, 0x255B8172L, 0x6C56E6FFL,
+        0xB7414E68L, 0xFE4C29E5L, 0x444605F7L, 0x0D4B627AL, 0xD65CCAEDL, 0x9F51AD60L,
+        0x64B28674L, 0x2DBFE1F9L, 0xF6A8496EL, 0xBFA52EE3L, 0x867D0CFDL, 0xCF706B70L,
+        0x1467C3E7L, 0x5D6AA46AL, 0xA6898F7EL, 0xEF84E8F3L, 0x34934064L, 0x7D9E27E9L,
+        0xC7940BFBL, 0x8E996C76L, 0x558EC4E1L, 0x1C83A36CL, 0xE7608878L, 0xAE6DEFF5L,
+        0x757A4762L, 0x3C7720EFL, 0x0D9406BCL, 0x44996131L, 0x9F8EC9A6L, 0xD683AE2BL,
+        0x2D60853FL, 0x646DE2B2L, 0xBF7A4A25L, 0xF6772DA8L, 0x4C7D01BAL, 0x05706637L,
+        0xDE67CEA0L, 0x976AA92DL, 0x6C898239L, 0x2584E5B4L, 0xFE934D23L, 0xB79E2AAEL,
+        0x8E4608B0L, 0xC74B6F3DL, 0x1C5CC7AAL, 0x5551A027L, 0xAEB28B33L, 0xE7BFECBEL,
+        0x3CA84429L, 0x75A523A4L, 0xCFAF0FB6L, 0x86A2683BL, 0x5DB5C0ACL, 0x14B8A721L,
+        0xEF5B8C35L, 0xA656EBB8L, 0x7D41432FL, 0x344C24A2L, 0x0EF10713L, 0x47FC609EL,
+        0x9CEBC809L, 0xD5E6AF84L, 0x2E058490L, 0x6708E31DL, 0xBC1F4B8AL, 0xF5122C07L,
+        0x4F180015L, 0x06156798L, 0xDD02CF0FL, 0x940FA882L, 0x6FEC8396L, 0x26E1E41BL,
+        0xFDF64C8CL, 0xB4FB2B01L, 0x8D23091FL, 0xC42E6E92L, 0x1F39C605L, 0x5634A188L,
+        0xADD78A9CL, 0xE4DAED11L, 0x3FCD4586L, 0x76C0220BL, 0xCCCA0E19L, 0x85C76994L,
+        0x5ED0C103L, 0x17DDA68EL, 0xEC3E8D9AL, 0xA533EA17L, 0x7E244280L, 0x3729250DL,
+        0x0B5E05E2L, 0x4253626FL, 0x9944CAF8L, 0xD049AD75L, 0x2BAA8661L, 0x62A7E1ECL,
+        0xB9B0497BL, 0xF0BD2EF6L, 0x4AB702E4L, 0x03BA6569L, 0xD8ADCDFEL, 0x91A0AA73L,
+        0x6A438167L, 0x234EE6EAL, 0xF8594E7DL, 0xB15429F0L, 0x888C0BEEL, 0xC1816C63L,
+        0x1A96C4F4L, 0x539BA379L, 0xA878886DL, 0xE175EFE0L, 0x3A624777L, 0x736F20FAL,
+        0xC9650CE8L, 0x80686B65L, 0x5B7FC3F2L, 0x1272A47FL, 0xE9918F6BL, 0xA09CE8E6L,
+        0x7B8B4071L, 0x328627FCL, 0x083B044DL, 0x413663C0L, 0x9A21CB57L, 0xD32CACDAL,
+        0x28CF87CEL, 0x61C2E043L, 0xBAD548D4L, 0xF3D82F59L, 0x49D2034BL, 0x00DF64C6L,
+        0xDBC8CC51L, 0x92C5ABDCL, 0x692680C8L, 0x202BE745L, 0xFB3C4FD2L, 0xB231285FL,
+        0x8BE90A41L, 0xC2E46DCCL, 0x19F3C55BL, 0x50FEA2D6L, 0xAB1D89C2L, 0xE210EE4FL,
+        0x390746D8L, 0x700A2155L, 0xCA000D47L, 0x830D6ACAL, 0x581AC25DL, 0x1117A5D0L,
+        0xEAF48EC4L, 0xA3F9E949L, 0x78EE41DEL, 0x31E32653L
+        },
+        {
+        0x00000000L, 0x1B280D78L, 0x36501AF0L, 0x2D781788L, 0x6CA035E0L, 0x77883898L,
+        0x5AF02F10L, 0x41D82268L, 0xD9406BC0L, 0xC26866B8L, 0xEF107130L, 0xF4387C48L,
+        0xB5E05E20L, 0xAEC85358L, 0x83B044D0L, 0x989849A8L, 0xB641CA37L, 0xAD69C74FL,
+        0x8011D0C7L, 0x9B39DDBFL, 0xDAE1FFD7L, 0xC1C9F2AFL, 0xECB1E527L, 0xF799E85FL,
+        0x6F01A1F7L, 0x7429AC8FL, 0x5951BB07L, 0x4279B67FL, 0x03A19417L, 0x1889996FL,
+        0x35F18EE7L, 0x2ED9839FL, 0x684289D9L, 0x736A84A1L, 0x5E129329L, 0x453A9E51L,
+        0x04E2BC39L, 0x1FCAB141L, 0x32B2A6C9L, 0x299AABB1L, 0xB102E219L, 0xAA2AEF61L,
+        0x8752F8E9L, 0x9C7AF591L, 0xDDA2D7F9L, 0xC68ADA81L, 0xEBF2CD09L, 0xF0DAC071L,
+        0xDE0343EEL, 0xC52B4E96L, 0xE853591EL, 0xF37B5466L, 0xB2A3760EL, 0xA98B7B76L,
+        0x84F36CFEL, 0x9FDB6186L, 0x0743282EL, 0x1C6B2556L, 0x311332DEL, 0x2A3B3FA6L,
+        0x6BE31DCEL, 0x70CB10B6L, 0x5DB3073EL, 0x469B0A46L, 0xD08513B2L, 0xCBAD1ECAL,
+        0xE6D50942L, 0xFDFD043AL, 0xBC252652L, 0xA70D2B2AL, 0x8A753CA2L, 0x915D31DAL,
+        0x09C57872L, 0x12ED750AL, 0x3F956282L, 0x24BD6FFAL, 0x65654D92L, 0x7E4D40EAL,
+        0x53355762L, 0x481D5A1AL, 0x66C4D985L, 0x7DECD4FDL, 0x5094C375L, 0x4BBCCE0DL,
+        0x0A64EC65L, 0x114CE11DL, 0x3C34F695L, 0x271CFBEDL, 0xBF84B245L, 0xA4ACBF3DL,
+        0x89D4A8B5L, 0x92FCA5CDL, 0xD32487A5L, 0xC80C8ADDL, 0xE5749D55L, 0xFE5C902DL,
+        0xB8C79A6BL, 0xA3EF9713L, 0x8E97809BL, 0x95BF8DE3L, 0xD467AF8BL, 0xCF4FA2F3L,
+        0xE237B57BL, 0xF91FB803L, 0x6187F1ABL, 0x7AAFFCD3L, 0x57D7EB5BL, 0x4CFFE623L,
+        0x0D27C44BL, 0x160FC933L, 0x3B77DEBBL, 0x205FD3C3L, 0x0E86505CL, 0x15AE5D24L,
+        0x38D64AACL, 0x23FE47D4L, 0x622665BCL, 0x790E68C4L, 0x54767F4CL, 0x4F5E7234L,
+        0xD7C63B9CL, 0xCCEE36E4L, 0xE196216CL, 0xFABE2C14L, 0xBB660E7CL, 0xA04E0304L,
+        0x8D36148CL, 0x961E19F4L, 0xA5CB3AD3L, 0xBEE337ABL, 0x939B2023L, 0x88B32D5BL,
+        0xC96B0F33L, 0xD243024BL, 0xFF3B15C3L, 0xE41318BBL, 0x7C8B5113L, 0x67A35C6BL,
+        0x4ADB4BE3L, 0x51F3469BL, 0x102B64F3L, 0x0B03698BL, 0x267B7E03L, 0x3D53737BL,
+        0x138AF0E4L, 0x08A2FD9CL, 0x25DAEA14L, 0x3EF2E76CL, 0x7F2AC504L, 0x6402C87CL,
+        0x497ADFF4L, 0x5252D28CL, 0xCACA9B24L, 0xD1E2965CL, 0xFC9A81D4L, 0xE7B28CACL,
+        0xA66AAEC4L, 0xBD42A3BCL, 0x903AB434L, 0x8B12B94CL, 0xCD89B30AL, 0xD6A1BE72L,
+        0xFBD9A9FAL, 0xE0F1A482L, 0xA12986EAL, 0xBA018B92L, 0x97799C1AL, 0x8C519162L,
+        0x14C9D8CAL, 0x0FE1D5B2L, 0x2299C23AL, 0x39B1CF42L, 0x7869ED2AL, 0x6341E052L,
+        0x4E39F7DAL, 0x5511FAA2L, 0x7BC8793DL, 0x60E07445L, 0x4D9863CDL, 0x56B06EB5L,
+        0x17684CDDL, 0x0C4041A5L, 0x2138562DL, 0x3A105B55L, 0xA28812FDL, 0xB9A01F85L,
+        0x94D8080DL, 0x8FF00575L, 0xCE28271DL, 0xD5002A65L, 0xF8783DEDL, 0xE3503095L,
+        0x754E2961L, 0x6E662419L, 0x431E3391L, 0x58363EE9L, 0x19EE1C81L, 0x02C611F9L,
+        0x2FBE0671L, 0x34960B09L, 0xAC0E42A1L, 0xB7264FD9L, 0x9A5E5851L, 0x81765529L,
+        0xC0AE7741L, 0xDB867A39L, 0xF6FE6DB1L, 0xEDD660C9L, 0xC30FE356L, 0xD827EE2EL,
+        0xF55FF9A6L, 0xEE77F4DEL, 0xAFAFD6B6L, 0xB487DBCEL, 0x99FFCC46L, 0x82D7C13EL,
+        0x1A4F8896L, 0x016785EEL, 0x2C1F9266L, 0x37379F1EL, 0x76EFBD76L, 0x6DC7B00EL,
+        0x40BFA786L, 0x5B97AAFEL, 0x1D0CA0B8L, 0x0624ADC0L, 0x2B5CBA48L, 0x3074B730L,
+        0x71AC9558L, 0x6A849820L, 0x47FC8FA8L, 0x5CD482D0L, 0xC44CCB78L, 0xDF64C600L,
+        0xF21CD188L, 0xE934DCF0L, 0xA8ECFE98L, 0xB3C4F3E0L, 0x9EBCE468L, 0x8594E910L,
+        0xAB4D6A8FL, 0xB06567F7L, 0x9D1D707FL, 0x86357D07L, 0xC7ED5F6FL, 0xDCC55217L,
+        0xF1BD459FL, 0xEA9548E7L, 0x720D014FL, 0x69250C37L, 0x445D1BBFL, 0x5F7516C7L,
+        0x1EAD34AFL, 0x058539D7L, 0x28FD2E5FL, 0x33D52327L
+        },
+        {
+        0x00000000L, 0x4F576811L, 0x9EAED022L, 0xD1F9B833L, 0x399CBDF3L, 0x76CBD5E2L,
+        0xA7326DD1L, 0xE86505C0L, 0x73397BE6L, 0x3C6E13F7L, 0xED97ABC4L, 0xA2C0C3D5L,
+        0x4AA5C615L, 0x05F2AE04L, 0xD40B1637L, 0x9B5C7E26L, 0xE672F7CCL, 0xA9259FDDL,
+        0x78DC27EEL, 0x378B4FFFL, 0xDFEE4A3FL, 0x90B9222EL, 0x41409A1DL, 0x0E17F20CL,
+        0x954B8C2AL, 0xDA1CE43BL, 0x0BE55C08L, 0x44B23419L, 0xACD731D9L, 0xE38059C8L,
+        0x3279E1FBL, 0x7D2E89EAL, 0xC824F22FL, 0x87739A3EL, 0x568A220DL, 0x19DD4A1CL,
+        0xF1B84FDCL, 0xBEEF27CDL, 0x6F169FFEL, 0x2041F7EFL, 0xBB1D89C9L, 0xF44AE1D8L,
+        0x25B359EBL, 0x6AE431FAL, 0x8281343AL, 0xCDD65C2BL, 0x1C2FE418L, 0x53788C09L,
+        0x2E5605E3L, 0x61016DF2L, 0xB0F8D5C1L, 0xFFAFBDD0L, 0x17CAB810L, 0x589DD001L,
+        0x89646832L, 0xC6330023L, 0x5D6F7E05L, 0x12381614L, 0xC3C1AE27L, 0x8C96C636L,
+        0x64F3C3F6L, 0x2BA4ABE7L, 0xFA5D13D4L, 0xB50A7BC5L, 0x9488F9E9L, 0xDBDF91F8L,
+        0x0A2629CBL, 0x457141DAL, 0xAD14441AL, 0xE2432C0BL, 0x33BA9438L, 0x7CEDFC29L,
+        0xE7B1820FL, 0xA8E6EA1EL, 0x791F522DL, 0x36483A3CL, 0xDE2D3FFCL, 0x917A57EDL,
+        0x4083EFDEL, 0x0FD487CFL, 0x72FA0E25L, 0x3DAD6634L, 0xEC54DE07L, 0xA303B616L,
+        0x4B66B3D6L, 0x0431DBC7L, 0xD5C863F4L, 0x9A9F0BE5L, 0x01C375C3L, 0x4E941DD2L,
+        0x9F6DA5E1L, 0xD03ACDF0L, 0x385FC830L, 0x7708A021L, 0xA6F11812L, 0xE9A67003L,
+        0x5CAC0BC6L, 0x13FB63D7L, 0xC202DBE4L, 0x8D55B3F5L, 0x6530B635L, 0x2A67DE24L,
+        0xFB9E6617L, 0xB4C90E06L, 0x2F957020L, 0x60C21831L, 0xB13BA002L, 0xFE6CC813L,
+        0x1609CDD3L, 0x595EA5C2L, 0x88A71DF1L, 0xC7F075E0L, 0xBADEFC0AL, 0xF589941BL,
+        0x24702C28L, 0x6B274439L, 0x834241F9L, 0xCC1529E8L, 0x1DEC91DBL, 0x52BBF9CAL,
+        0xC9E787ECL, 0x86B0EFFDL, 0x574957CEL, 0x181E3FDFL, 0xF07B3A1FL, 0xBF2C520EL,
+        0x6ED5EA3DL, 0x2182822CL, 0x2DD0EE65L, 0x62878674L, 0xB37E3E47L, 0xFC295656L,
+        0x144C5396L, 0x5B1B3B87L, 0x8AE283B4L, 0xC5B5EBA5L, 0x5EE99583L, 0x11BEFD92L,
+        0xC04745A1L, 0x8F102DB0L, 0x67752870L, 0x28224061L, 0xF9DBF852L, 0xB68C9043L,
+        0xCBA219A9L, 0x84F571B8L, 0x550CC98BL, 0x1A5BA19AL, 0xF23EA45AL, 0xBD69CC4BL,
+        0x6C907478L, 0x23C71C69L, 0xB89B624FL, 0xF7CC0A5EL, 0x2635B26DL, 0x6962DA7CL,
+        0x8107DFBCL, 0xCE50B7ADL, 0x1FA90F9EL, 0x50FE678FL, 0xE5F41C4AL, 0xAAA3745BL,
+        0x7B5ACC68L, 0x340DA479L, 0xDC68A1B9L, 0x933FC9A8L, 0x42C6719BL, 0x0D91198AL,
+        0x96CD67ACL, 0xD99A0FBDL, 0x0863B78EL, 0x4734DF9FL, 0xAF51DA5FL, 0xE006B24EL,
+        0x31FF0A7DL, 0x7EA8626CL, 0x0386EB86L, 0x4CD18397L, 0x9D283BA4L, 0xD27F53B5L,
+        0x3A1A5675L, 0x754D3E64L, 0xA4B48657L, 0xEBE3EE46L, 0x70BF9060L, 0x3FE8F871L,
+        0xEE114042L, 0xA1462853L, 0x49232D93L, 0x06744582L, 0xD78DFDB1L, 0x98DA95A0L,
+        0xB958178CL, 0xF60F7F9DL, 0x27F6C7AEL, 0x68A1AFBFL, 0x80C4AA7FL, 0xCF93C26EL,
+        0x1E6A7A5DL, 0x513D124CL, 0xCA616C6AL, 0x8536047BL, 0x54CFBC48L, 0x1B98D459L,
+        0xF3FDD199L, 0xBCAAB988L, 0x6D5301BBL, 0x220469AAL, 0x5F2AE040L, 0x107D8851L,
+        0xC1843062L, 0x8ED35873L, 0x66B65DB3L, 0x29E135A2L, 0xF8188D91L, 0xB74FE580L,
+        0x2C139BA6L, 0x6344F3B7L, 0xB2BD4B84L, 0xFDEA2395L, 0x158F2655L, 0x5AD84E44L,
+        0x8B21F677L, 0xC4769E66L, 0x717CE5A3L, 0x3E2B8DB2L, 0xEFD23581L, 0xA0855D90L,
+        0x48E05850L, 0x07B73041L, 0xD64E8872L, 0x9919E063L, 0x02459E45L, 0x4D12F654L,
+        0x9CEB4E67L, 0xD3BC2676L, 0x3BD923B6L, 0x748E4BA7L, 0xA577F394L, 0xEA209B85L,
+        0x970E126FL, 0xD8597A7EL, 0x09A0C24DL, 0x46F7AA5CL, 0xAE92AF9CL, 0xE1C5C78DL,
+        0x303C7FBEL, 0x7F6B17AFL, 0xE4376989L, 0xAB600198L, 0x7A99B9ABL, 0x35CED1BAL,
+        0xDDABD47AL, 0x92FCBC6BL, 0x43050458L, 0x0C526C49L
+        },
+        {
+        0x00000000L, 0x5BA1DCCAL, 0xB743B994L, 0xECE2655EL, 0x6A466E9FL, 0x31E7B255L,
+        0xDD05D70BL, 0x86A40BC1L, 0xD48CDD3EL, 0x8F2D01F4L, 0x63CF64AAL, 0x386EB860L,
+        0xBECAB3A1L, 0xE56B6F6BL, 0x09890A35L, 0x5228D6FFL, 0xADD8A7CBL, 0xF6797B01L,
+        0x1A9B1E5FL, 0x413AC295L, 0xC79EC954L, 0x9C3F159EL, 0x70DD70C0L, 0x2B7CAC0AL,
+        0x79547AF5L, 0x22F5A63FL, 0xCE17C361L, 0x95B61FABL, 0x1312146AL, 0x48B3C8A0L,
+        0xA451ADFEL, 0xFFF07134L, 0x5F705221L, 0x04D18EEBL, 0xE833EBB5L, 0xB392377FL,
+        0x35363CBEL, 0x6E97E074L, 0x8275852AL, 0xD9D459E0L, 0x8BFC8F1FL, 0xD05D53D5L,
+        0x3CBF368BL, 0x671EEA41L, 0xE1BAE180L, 0xBA1B3D4AL, 0x56F95814L, 0x0D5884DEL,
+        0xF2A8F5EAL, 0xA9092920L, 0x45EB4C7EL, 0x1E4A90B4L, 0x98EE9B75L, 0xC34F47BFL,
+        0x2FAD22E1L, 0x740CFE2BL, 0x262428D4L, 0x7D85F41EL, 0x91679140L, 0xCAC64D8AL,
+        0x4C62464BL, 0x17C39A81L, 0xFB21FFDFL, 0xA0802315L, 0xBEE0A442L, 0xE5417888L,
+        0x09A31DD6L, 0x5202C11CL, 0xD4A6CADDL, 0x8F071617L, 0x63E57349L, 0x3844AF83L,
+        0x6A6C797CL, 0x31CDA5B6L, 0xDD2FC0E8L, 0x868E1C22L, 0x002A17E3L, 0x5B8BCB29L,
+        0xB769AE77L, 0xECC872BDL, 0x13380389L, 0x4899DF43L, 0xA47BBA1DL, 0xFFDA66D7L,
+        0x797E6D16L, 0x22DFB1DCL, 0xCE3DD482L, 0x959C0848L, 0xC7B4DEB7L, 0x9C15027DL,
+        0x70F76723L, 0x2B56BBE9L, 0xADF2B028L, 0xF6536CE2L, 0x1AB109BCL, 0x4110D576L,
+        0xE190F663L, 0xBA312AA9L, 0x56D34FF7L, 0x0D72933DL, 0x8BD698FCL, 0xD0774436L,
+        0x3C952168L, 0x6734FDA2L, 0x351C2B5DL, 0x6EBDF797L, 0x825F92C9L, 0xD9FE4E03L,
+        0x5F5A45C2L, 0x04FB9908L, 0xE819FC56L, 0xB3B8209CL, 0x4C4851A8L, 0x17E98D62L,
+        0xFB0BE83CL, 0xA0AA34F6L, 0x260E3F37L, 0x7DAFE3FDL, 0x914D86A3L, 0xCAEC5A69L,
+        0x98C48C96L, 0xC365505CL, 0x2F873502L, 0x7426E9C8L, 0xF282E209L, 0xA9233EC3L,
+        0x45C15B9DL, 0x1E608757L, 0x79005533L, 0x22A189F9L, 0xCE43ECA7L, 0x95E2306DL,
+        0x13463BACL, 0x48E7E766L, 0xA4058238L, 0xFFA45EF2L, 0xAD8C880DL, 0xF62D54C7L,
+        0x1ACF3199L, 0x416EED53L, 0xC7CAE692L, 0x9C6B3A58L, 0x70895F06L, 0x2B2883CCL,
+        0xD4D8F2F8L, 0x8F792E32L, 0x639B4B6CL, 0x383A97A6L, 0xBE9E9C67L, 0xE53F40ADL,
+        0x09DD25F3L, 0x527CF939L, 0x00542FC6L, 0x5BF5F30CL, 0xB7179652L, 0xECB64A98L,
+        0x6A124159L, 0x31B39D93L, 0xDD51F8CDL, 0x86F02407L, 0x26700712L, 0x7DD1DBD8L,
+        0x9133BE86L, 0xCA92624CL, 0x4C36698DL, 0x1797B547L, 0xFB75D019L, 0xA0D40CD3L,
+        0xF2FCDA2CL, 0xA95D06E6L, 0x45BF63B8L, 0x1E1EBF72L, 0x98BAB4B3L, 0xC31B6879L,
+        0x2FF90D27L, 0x7458D1EDL, 0x8BA8A0D9L, 0xD0097C13L, 0x3CEB194DL, 0x674AC587L,
+        0xE1EECE46L, 0xBA4F128CL, 0x56AD77D2L, 0x0D0CAB18L, 0x5F247DE7L, 0x0485A12DL,
+        0xE867C473L, 0xB3C618B9L, 0x35621378L, 0x6EC3CFB2L, 0x8221AAECL, 0xD9807626L,
+        0xC7E0F171L, 0x9C412DBBL, 0x70A348E5L, 0x2B02942FL, 0xADA69FEEL, 0xF6074324L,
+        0x1AE5267AL, 0x4144FAB0L, 0x136C2C4FL, 0x48CDF085L, 0xA42F95DBL, 0xFF8E4911L,
+        0x792A42D0L, 0x228B9E1AL, 0xCE69FB44L, 0x95C8278EL, 0x6A3856BAL, 0x31998A70L,
+        0xDD7BEF2EL, 0x86DA33E4L, 0x007E3825L, 0x5BDFE4EFL, 0xB73D81B1L, 0xEC9C5D7BL,
+        0xBEB48B84L, 0xE515574EL, 0x09F73210L, 0x5256EEDAL, 0xD4F2E51BL, 0x8F5339D1L,
+        0x63B15C8FL, 0x38108045L, 0x9890A350L, 0xC3317F9AL, 0x2FD31AC4L, 0x7472C60EL,
+        0xF2D6CDCFL, 0xA9771105L, 0x4595745BL, 0x1E34A891L, 0x4C1C7E6EL, 0x17BDA2A4L,
+        0xFB5FC7FAL, 0xA0FE1B30L, 0x265A10F1L, 0x7DFBCC3BL, 0x9119A965L, 0xCAB875AFL,
+        0x3548049BL, 0x6EE9D851L, 0x820BBD0FL, 0xD9AA61C5L, 0x5F0E6A04L, 0x04AFB6CEL,
+        0xE84DD390L, 0xB3EC0F5AL, 0xE1C4D9A5L, 0xBA65056FL, 0x56876031L, 0x0D26BCFBL,
+        0x8B82B73AL, 0xD0236BF0L, 0x3CC10EAEL, 0x6760D264L
+        },
+#endif
+
+#if STM32CRC_SLICING > 8
+        {
+        0x00000000L, 0xF200AA66L, 0xE0C0497BL, 0x12C0E31DL, 0xC5418F41L, 0x37412527L,
+        0x2581C63AL, 0xD7816C5CL, 0x8E420335L, 0x7C42A953L, 0x6E824A4EL, 0x9C82E028L,
+        0x4B038C74L, 0xB9032612L, 0xABC3C50FL, 0x59C36F69L, 0x18451BDDL, 0xEA45B1BBL,
+        0xF88552A6L, 0x0A85F8C0L, 0xDD04949CL, 0x2F043EFAL, 0x3DC4DDE7L, 0xCFC47781L,
+        0x960718E8L, 0x6407B28EL, 0x76C75193L, 0x84C7FBF5L, 0x534697A9L, 0xA1463DCFL,
+        0xB386DED2L, 0x418674B4L, 0x308A37BAL, 0xC28A9DDCL, 0xD04A7EC1L, 0x224AD4A7L,
+        0xF5CBB8FBL, 0x07CB129DL, 0x150BF180L, 0xE70B5BE6L, 0xBEC8348FL, 0x4CC89EE9L,
+        0x5E087DF4L, 0xAC08D792L, 0x7B89BBCEL, 0x898911A8L, 0x9B49F2B5L, 0x694958D3L,
+        0x28CF2C67L, 0xDACF8601L, 0xC80F651CL, 0x3A0FCF7AL, 0xED8EA326L, 0x1F8E0940L,
+        0x0D4EEA5DL, 0xFF4E403BL, 0xA68D2F52L, 0x548D8534L, 0x464D6629L, 0xB44DCC4FL,
+        0x63CCA013L, 0x91CC0A75L, 0x830CE968L, 0x710C430EL, 0x61146F74L, 0x9314C512L,
+        0x81D4260FL, 0x73D48C69L, 0xA455E035L, 0x56554A53L, 0x4495A94EL, 0xB6950328L,
+        0xEF566C41L, 0x1D56C627L, 0x0F96253AL, 0xFD968F5CL, 0x2A17E300L, 0xD8174966L,
+        0xCAD7AA7BL, 0x38D7001DL, 0x795174A9L, 0x8B51DECFL, 0x99913DD2L, 0x6B9197B4L,
+        0xBC10FBE8L, 0x4E10518EL, 0x5CD0B293L, 0xAED018F5L, 0xF713779CL, 0x0513DDFAL,
+        0x17D33EE7L, 0xE5D39481L, 0x3252F8DDL, 0xC05252BBL, 0xD292B1A6L, 0x20921BC0L,
+        0x519E58CEL, 0xA39EF2A8L, 0xB15E11B5L, 0x435EBBD3L, 0x94DFD78FL, 0x66DF7DE9L,
+        0x741F9EF4L, 0x861F3492L, 0xDFDC5BFBL, 0x2DDCF19DL, 0x3F1C1280L, 0xCD1CB8E6L,
+        0x1A9DD4BAL, 0xE89D7EDCL, 0xFA5D9DC1L, 0x085D37A7L, 0x49DB4313L, 0xBBDBE975L,
+        0xA91B0A68L, 0x5B1BA00EL, 0x8C9ACC52L, 0x7E9A6634L, 0x6C5A8529L, 0x9E5A2F4FL,
+        0xC7994026L, 0x3599EA40L, 0x2759095DL, 0xD559A33BL, 0x02D8CF67L, 0xF0D86501L,
+        0xE218861CL, 0x10182C7AL, 0xC228DEE8L, 0x3028748EL, 0x22E89793L, 0xD0E83DF5L,
+        0x076951A9L, 0xF569FBCFL, 0xE7A918D2L, 0x15A9B2B4L, 0x4C6ADDDDL, 0xBE6A77BBL,
+        0xACAA94A6L, 0x5EAA3EC0L, 0x892B529CL, 0x7B2BF8FAL, 0x69EB1BE7L, 0x9BEBB181L,
+        0xDA6DC535L, 0x286D6F53L, 0x3AAD8C4EL, 0xC8AD2628L, 0x1F2C4A74L, 0xED2CE012L,
+        0xFFEC030FL, 0x0DECA969L, 0x542FC600L, 0xA62F6C66L, 0xB4EF8F7BL, 0x46EF251DL,
+        0x916E4941L, 0x636EE327L, 0x71AE003AL, 0x83AEAA5CL, 0xF2A2E952L, 0x00A24334L,
+        0x1262A029L, 0xE0620A4FL, 0x37E36613L, 0xC5E3CC75L, 0xD7232F68L, 0x2523850EL,
+        0x7CE0EA67L, 0x8EE04001L, 0x9C20A31CL, 0x6E20097AL, 0xB9A16526L, 0x4BA1CF40L,
+        0x59612C5DL, 0xAB61863BL, 0xEAE7F28FL, 0x18E758E9L, 0x0A27BBF4L, 0xF8271192L,
+        0x2FA67DCEL, 0xDDA6D7A8L, 0xCF6634B5L, 0x3D669ED3L, 0x64A5F1BAL, 0x96A55BDCL,
+        0x8465B8C1L, 0x766512A7L, 0xA1E47EFBL, 0x53E4D49DL, 0x41243780L, 0xB3249DE6L,
+        0xA33CB19CL, 0x513C1BFAL, 0x43FCF8E7L, 0xB1FC5281L, 0x667D3EDDL, 0x947D94BBL,
+        0x86BD77A6L, 0x74BDDDC0L, 0x2D7EB2A9L, 0xDF7E18CFL, 0xCDBEFBD2L, 0x3FBE51B4L,
+        0xE83F3DE8L, 0x1A3F978EL, 0x08FF7493L, 0xFAFFDEF5L, 0xBB79AA41L, 0x49790027L,
+        0x5BB9E33AL, 0xA9B9495CL, 0x7E382500L, 0x8C388F66L, 0x9EF86C7BL, 0x6CF8C61DL,
+        0x353BA974L, 0xC73B0312L, 0xD5FBE00FL, 0x27FB4A69L, 0xF07A2635L, 0x027A8C53L,
+        0x10BA6F4EL, 0xE2BAC528L, 0x93B68626L, 0x61B62C40L, 0x7376CF5DL, 0x8176653BL,
+        0x56F70967L, 0xA4F7A301L, 0xB637401CL, 0x4437EA7AL, 0x1DF48513L, 0xEFF42F75L,
+        0xFD34CC68L, 0x0F34660EL, 0xD8B50A52L, 0x2AB5A034L, 0x38754329L, 0xCA75E94FL,
+        0x8BF39DFBL, 0x79F3379DL, 0x6B33D480L, 0x99337EE6L, 0x4EB212BAL, 0xBCB2B8DCL,
+        0xAE725BC1L, 0x5C72F1A7L, 0x05B19ECEL, 0xF7B134A8L, 0xE571D7B5L, 0x17717DD3L,
+        0xC0F0118FL, 0x32F0BBE9L, 0x203058F4L, 0xD230F292L
+        },
+        {
+        0x00000000L, 0x8090A067L, 0x05E05D79L, 0x8570FD1EL, 0x0BC0BAF2L, 0x8B501A95L,
+        0x0E20E78BL, 0x8EB047ECL, 0x178175E4L, 0x9711D583L, 0x1261289DL, 0x92F188FAL,
+        0x1C41CF16L, 0x9CD16F71L, 0x19A1926FL, 0x99313208L, 0x2F02EBC8L, 0xAF924BAFL,
+        0x2AE2B6B1L, 0xAA7216D6L, 0x24C2513AL, 0xA452F15DL, 0x21220C43L, 0xA1B2AC24L,
+        0x38839E2CL, 0xB8133E4BL, 0x3D63C355L, 0xBDF36332L, 0x334324DEL, 0xB3D384B9L,
+        0x36A379A7L, 0xB633D9C0L, 0x5E05D790L, 0xDE9577F7L, 0x5BE58AE9L, 0xDB752A8EL,
+        0x55C56D62L, 0xD555CD05L, 0x5025301BL, 0xD0B5907CL, 0x4984A274L, 0xC9140213L,
+        0x4C64FF0DL, 0xCCF45F6AL, 0x42441886L, 0xC2D4B8E1L, 0x47A445FFL, 0xC734E598L,
+        0x71073C58L, 0xF1979C3FL, 0x74E76121L, 0xF477C146L, 0x7AC786AAL, 0xFA5726CDL,
+        0x7F27DBD3L, 0xFFB77BB4L, 0x668649BCL, 0xE616E9DBL, 0x636614C5L, 0xE3F6B4A2L,
+        0x6D46F34EL, 0xEDD65329L, 0x68A6AE37L, 0xE8360E50L, 0xBC0BAF20L, 0x3C9B0F47L,
+        0xB9EBF259L, 0x397B523EL, 0xB7CB15D2L, 0x375BB5B5L, 0xB22B48ABL, 0x32BBE8CCL,
+        0xAB8ADAC4L, 0x2B1A7AA3L, 0xAE6A87BDL, 0x2EFA27DAL, 0xA04A6036L, 0x20DAC051L,
+        0xA5AA3D4FL, 0x253A9D28L, 0x930944E8L, 0x1399E48FL, 0x96E91991L, 0x1679B9F6L,
+        0x98C9FE1AL, 0x18595E7DL, 0x9D29A363L, 0x1DB90304L, 0x8488310CL, 0x0418916BL,
+        0x81686C75L, 0x01F8CC12L, 0x8F488BFEL, 0x0FD82B99L, 0x8AA8D687L, 0x0A3876E0L,
+        0xE20E78B0L, 0x629ED8D7L, 0xE7EE25C9L, 0x677E85AEL, 0xE9CEC242L, 0x695E6225L,
+        0xEC2E9F3BL, 0x6CBE3F5CL, 0xF58F0D54L, 0x751FAD33L, 0xF06F502DL, 0x70FFF04AL,
+        0xFE4FB7A6L, 0x7EDF17C1L, 0xFBAFEADFL, 0x7B3F4AB8L, 0xCD0C9378L, 0x4D9C331FL,
+        0xC8ECCE01L, 0x487C6E66L, 0xC6CC298AL, 0x465C89EDL, 0xC32C74F3L, 0x43BCD494L,
+        0xDA8DE69CL, 0x5A1D46FBL, 0xDF6DBBE5L, 0x5FFD1B82L, 0xD14D5C6EL, 0x51DDFC09L,
+        0xD4AD0117L, 0x543DA170L, 0x7CD643F7L, 0xFC46E390L, 0x79361E8EL, 0xF9A6BEE9L,
+        0x7716F905L, 0xF7865962L, 0x72F6A47CL, 0xF266041BL, 0x6B573613L, 0xEBC79674L,
+        0x6EB76B6AL, 0xEE27CB0DL, 0x60978CE1L, 0xE0072C86L, 0x6577D198L, 0xE5E771FFL,
+        0x53D4A83FL, 0xD3440858L, 0x5634F546L, 0xD6A45521L, 0x581412CDL, 0xD884B2AAL,
+        0x5DF44FB4L, 0xDD64EFD3L, 0x4455DDDBL, 0xC4C57DBCL, 0x41B580A2L, 0xC12520C5L,
+        0x4F956729L, 0xCF05C74EL, 0x4A753A50L, 0xCAE59A37L, 0x22D39467L, 0xA2433400L,
+        0x2733C91EL, 0xA7A36979L, 0x29132E95L, 0xA9838EF2L, 0x2CF373ECL, 0xAC63D38BL,
+        0x3552E183L, 0xB5C241E4L, 0x30B2BCFAL, 0xB0221C9DL, 0x3E925B71L, 0xBE02FB16L,
+        0x3B720608L, 0xBBE2A66FL, 0x0DD17FAFL, 0x8D41DFC8L, 0x083122D6L, 0x88A182B1L,
+        0x0611C55DL, 0x8681653AL, 0x03F19824L, 0x83613843L, 0x1A500A4BL, 0x9AC0AA2CL,
+        0x1FB05732L, 0x9F20F755L, 0x1190B0B9L, 0x910010DEL, 0x1470EDC0L, 0x94E04DA7L,
+        0xC0DDECD7L, 0x404D4CB0L, 0xC53DB1AEL, 0x45AD11C9L, 0xCB1D5625L, 0x4B8DF642L,
+        0xCEFD0B5CL, 0x4E6DAB3BL, 0xD75C9933L, 0x57CC3954L, 0xD2BCC44AL, 0x522C642DL,
+        0xDC9C23C1L, 0x5C0C83A6L, 0xD97C7EB8L, 0x59ECDEDFL, 0xEFDF071FL, 0x6F4FA778L,
+        0xEA3F5A66L, 0x6AAFFA01L, 0xE41FBDEDL, 0x648F1D8AL, 0xE1FFE094L, 0x616F40F3L,
+        0xF85E72FBL, 0x78CED29CL, 0xFDBE2F82L, 0x7D2E8FE5L, 0xF39EC809L, 0x730E686EL,
+        0xF67E9570L, 0x76EE3517L, 0x9ED83B47L, 0x1E489B20L, 0x9B38663EL, 0x1BA8C659L,
+        0x951881B5L, 0x158821D2L, 0x90F8DCCCL, 0x10687CABL, 0x89594EA3L, 0x09C9EEC4L,
+        0x8CB913DAL, 0x0C29B3BDL, 0x8299F451L, 0x02095436L, 0x8779A928L, 0x07E9094FL,
+        0xB1DAD08FL, 0x314A70E8L, 0xB43A8DF6L, 0x34AA2D91L, 0xBA1A6A7DL, 0x3A8ACA1AL,
+        0xBFFA3704L, 0x3F6A9763L, 0xA65BA56BL, 0x26CB050CL, 0xA3BBF812L, 0x232B5875L,
+        0xAD9B1F99L, 0x2D0BBFFEL, 0xA87B42E0L, 0x28EBE287L
+        },
+        {
+        0x00000000L, 0xF9AC87EEL, 0xF798126BL, 0x0E349585L, 0xEBF13961L, 0x125DBE8FL,
+        0x1C692B0AL, 0xE5C5ACE4L, 0xD3236F75L, 0x2A8FE89BL, 0x24BB7D1EL, 0xDD17FAF0L,
+        0x38D25614L, 0xC17ED1FAL, 0xCF4A447FL, 0x36E6C391L, 0xA287C35DL, 0x5B2B44B3L,
+        0x551FD136L, 0xACB356D8L, 0x4976FA3CL, 0xB0DA7DD2L, 0xBEEEE857L, 0x47426FB9L,
+        0x71A4AC28L, 0x88082BC6L, 0x863CBE43L, 0x7F9039ADL, 0x9A559549L, 0x63F912A7L,
+        0x6DCD8722L, 0x946100CCL, 0x41CE9B0DL, 0xB8621CE3L, 0xB6568966L, 0x4FFA0E88L,
+        0xAA3FA26CL, 0x53932582L, 0x5DA7B007L, 0xA40B37E9L, 0x92EDF478L, 0x6B417396L,
+        0x6575E613L, 0x9CD961FDL, 0x791CCD19L, 0x80B04AF7L, 0x8E84DF72L, 0x7728589CL,
+        0xE3495850L, 0x1AE5DFBEL, 0x14D14A3BL, 0xED7DCDD5L, 0x08B86131L, 0xF114E6DFL,
+        0xFF20735AL, 0x068CF4B4L, 0x306A3725L, 0xC9C6B0CBL, 0xC7F2254EL, 0x3E5EA2A0L,
+        0xDB9B0E44L, 0x223789AAL, 0x2C031C2FL, 0xD5AF9BC1L, 0x839D361AL, 0x7A31B1F4L,
+        0x74052471L, 0x8DA9A39FL, 0x686C0F7BL, 0x91C08895L, 0x9FF41D10L, 0x66589AFEL,
+        0x50BE596FL, 0xA912DE81L, 0xA7264B04L, 0x5E8ACCEAL, 0xBB4F600EL, 0x42E3E7E0L,
+        0x4CD77265L, 0xB57BF58BL, 0x211AF547L, 0xD8B672A9L, 0xD682E72CL, 0x2F2E60C2L,
+        0xCAEBCC26L, 0x33474BC8L, 0x3D73DE4DL, 0xC4DF59A3L, 0xF2399A32L, 0x0B951DDCL,
+        0x05A18859L, 0xFC0D0FB7L, 0x19C8A353L, 0xE06424BDL, 0xEE50B138L, 0x17FC36D6L,
+        0xC253AD17L, 0x3BFF2AF9L, 0x35CBBF7CL, 0xCC673892L, 0x29A29476L, 0xD00E1398L,
+        0xDE3A861DL, 0x279601F3L, 0x1170C262L, 0xE8DC458CL, 0xE6E8D009L, 0x1F4457E7L,
+        0xFA81FB03L, 0x032D7CEDL, 0x0D19E968L, 0xF4B56E86L, 0x60D46E4AL, 0x9978E9A4L,
+        0x974C7C21L, 0x6EE0FBCFL, 0x8B25572BL, 0x7289D0C5L, 0x7CBD4540L, 0x8511C2AEL,
+        0xB3F7013FL, 0x4A5B86D1L, 0x446F1354L, 0xBDC394BAL, 0x5806385EL, 0xA1AABFB0L,
+        0xAF9E2A35L, 0x5632ADDBL, 0x03FB7183L, 0xFA57F66DL, 0xF46363E8L, 0x0DCFE406L,
+        0xE80A48E2L, 0x11A6CF0CL, 0x1F925A89L, 0xE63EDD67L, 0xD0D81EF6L, 0x29749918L,
+        0x27400C9DL, 0xDEEC8B73L, 0x3B292797L, 0xC285A079L, 0xCCB135FCL, 0x351DB212L,
+        0xA17CB2DEL, 0x58D03530L, 0x56E4A0B5L, 0xAF48275BL, 0x4A8D8BBFL, 0xB3210C51L,
+        0xBD1599D4L, 0x44B91E3AL, 0x725FDDABL, 0x8BF35A45L, 0x85C7CFC0L, 0x7C6B482EL,
+        0x99AEE4CAL, 0x60026324L, 0x6E36F6A1L, 0x979A714FL, 0x4235EA8EL, 0xBB996D60L,
+        0xB5ADF8E5L, 0x4C017F0BL, 0xA9C4D3EFL, 0x50685401L, 0x5E5CC184L, 0xA7F0466AL,
+        0x911685FBL, 0x68BA0215L, 0x668E9790L, 0x9F22107EL, 0x7AE7BC9AL, 0x834B3B74L,
+        0x8D7FAEF1L, 0x74D3291FL, 0xE0B229D3L, 0x191EAE3DL, 0x172A3BB8L, 0xEE86BC56L,
+        0x0B4310B2L, 0xF2EF975CL, 0xFCDB02D9L, 0x05778537L, 0x339146A6L, 0xCA3DC148L,
+        0xC40954CDL, 0x3DA5D323L, 0xD8607FC7L, 0x21CCF829L, 0x2FF86DACL, 0xD654EA42L,
+        0x80664799L, 0x79CAC077L, 0x77FE55F2L, 0x8E52D21CL, 0x6B977EF8L, 0x923BF916L,
+        0x9C0F6C93L, 0x65A3EB7DL, 0x534528ECL, 0xAAE9AF02L, 0xA4DD3A87L, 0x5D71BD69L,
+        0xB8B4118DL, 0x41189663L, 0x4F2C03E6L, 0xB6808408L, 0x22E184C4L, 0xDB4D032AL,
+        0xD57996AFL, 0x2CD51141L, 0xC910BDA5L, 0x30BC3A4BL, 0x3E88AFCEL, 0xC7242820L,
+        0xF1C2EBB1L, 0x086E6C5FL, 0x065AF9DAL, 0xFFF67E34L, 0x1A33D2D0L, 0xE39F553EL,
+        0xEDABC0BBL, 0x14074755L, 0xC1A8DC94L, 0x38045B7AL, 0x3630CEFFL, 0xCF9C4911L,
+        0x2A59E5F5L, 0xD3F5621BL, 0xDDC1F79EL, 0x246D7070L, 0x128BB3E1L, 0xEB27340FL,
+        0xE513A18AL, 0x1CBF2664L, 0xF97A8A80L, 0x00D60D6EL, 0x0EE298EBL, 0xF74E1F05L,
+        0x632F1FC9L, 0x9A839827L, 0x94B70DA2L, 0x6D1B8A4CL, 0x88DE26A8L, 0x7172A146L,
+        0x7F4634C3L, 0x86EAB32DL, 0xB00C70BCL, 0x49A0F752L, 0x479462D7L, 0xBE38E539L,
+        0x5BFD49DDL, 0xA251CE33L, 0xAC655BB6L, 0x55C9DC58L
+        },
+        {
+        0x00000000L, 0x07F6E306L, 0x0FEDC60CL, 0x081B250AL, 0x1FDB8C18L, 0x182D6F1EL,
+        0x10364A14L, 0x17C0A912L, 0x3FB71830L, 0x3841FB36L, 0x305ADE3CL, 0x37AC3D3AL,
+        0x206C9428L, 0x279A772EL, 0x2F815224L, 0x2877B122L, 0x7F6E3060L, 0x7898D366L,
+        0x7083F66CL, 0x7775156AL, 0x60B5BC78L, 0x67435F7EL, 0x6F587A74L, 0x68AE9972L,
+        0x40D92850L, 0x472FCB56L, 0x4F34EE5CL, 0x48C20D5AL, 0x5F02A448L, 0x58F4474EL,
+        0x50EF6244L, 0x57198142L, 0xFEDC60C0L, 0xF92A83C6L, 0xF131A6CCL, 0xF6C745CAL,
+        0xE107ECD8L, 0xE6F10FDEL, 0xEEEA2AD4L, 0xE91CC9D2L, 0xC16B78F0L, 0xC69D9BF6L,
+        0xCE86BEFCL, 0xC9705DFAL, 0xDEB0F4E8L, 0xD94617EEL, 0xD15D32E4L, 0xD6ABD1E2L,
+        0x81B250A0L, 0x8644B3A6L, 0x8E5F96ACL, 0x89A975AAL, 0x9E69DCB8L, 0x999F3FBEL,
+        0x91841AB4L, 0x9672F9B2L, 0xBE054890L, 0xB9F3AB96L, 0xB1E88E9CL, 0xB61E6D9AL,
+        0xA1DEC488L, 0xA628278EL, 0xAE330284L, 0xA9C5E182L, 0xF979DC37L, 0xFE8F3F31L,
+        0xF6941A3BL, 0xF162F93DL, 0xE6A2502FL, 0xE154B329L, 0xE94F9623L, 0xEEB97525L,
+        0xC6CEC407L, 0xC1382701L, 0xC923020BL, 0xCED5E10DL, 0xD915481FL, 0xDEE3AB19L,
+        0xD6F88E13L, 0xD10E6D15L, 0x8617EC57L, 0x81E10F51L, 0x89FA2A5BL, 0x8E0CC95DL,
+        0x99CC604FL, 0x9E3A8349L, 0x9621A643L, 0x91D74545L, 0xB9A0F467L, 0xBE561761L,
+        0xB64D326BL, 0xB1BBD16DL, 0xA67B787FL, 0xA18D9B79L, 0xA996BE73L, 0xAE605D75L,
+        0x07A5BCF7L, 0x00535FF1L, 0x08487AFBL, 0x0FBE99FDL, 0x187E30EFL, 0x1F88D3E9L,
+        0x1793F6E3L, 0x106515E5L, 0x3812A4C7L, 0x3FE447C1L, 0x37FF62CBL, 0x300981CDL,
+        0x27C928DFL, 0x203FCBD9L, 0x2824EED3L, 0x2FD20DD5L, 0x78CB8C97L, 0x7F3D6F91L,
+        0x77264A9BL, 0x70D0A99DL, 0x6710008FL, 0x60E6E389L, 0x68FDC683L, 0x6F0B2585L,
+        0x477C94A7L, 0x408A77A1L, 0x489152ABL, 0x4F67B1ADL, 0x58A718BFL, 0x5F51FBB9L,
+        0x574ADEB3L, 0x50BC3DB5L, 0xF632A5D9L, 0xF1C446DFL, 0xF9DF63D5L, 0xFE2980D3L,
+        0xE9E929C1L, 0xEE1FCAC7L, 0xE604EFCDL, 0xE1F20CCBL, 0xC985BDE9L, 0xCE735EEFL,
+        0xC6687BE5L, 0xC19E98E3L, 0xD65E31F1L, 0xD1A8D2F7L, 0xD9B3F7FDL, 0xDE4514FBL,
+        0x895C95B9L, 0x8EAA76BFL, 0x86B153B5L, 0x8147B0B3L, 0x968719A1L, 0x9171FAA7L,
+        0x996ADFADL, 0x9E9C3CABL, 0xB6EB8D89L, 0xB11D6E8FL, 0xB9064B85L, 0xBEF0A883L,
+        0xA9300191L, 0xAEC6E297L, 0xA6DDC79DL, 0xA12B249BL, 0x08EEC519L, 0x0F18261FL,
+        0x07030315L, 0x00F5E013L, 0x17354901L, 0x10C3AA07L, 0x18D88F0DL, 0x1F2E6C0BL,
+        0x3759DD29L, 0x30AF3E2FL, 0x38B41B25L, 0x3F42F823L, 0x28825131L, 0x2F74B237L,
+        0x276F973DL, 0x2099743BL, 0x7780F579L, 0x7076167FL, 0x786D3375L, 0x7F9BD073L,
+        0x685B7961L, 0x6FAD9A67L, 0x67B6BF6DL, 0x60405C6BL, 0x4837ED49L, 0x4FC10E4FL,
+        0x47DA2B45L, 0x402CC843L, 0x57EC6151L, 0x501A8257L, 0x5801A75DL, 0x5FF7445BL,
+        0x0F4B79EEL, 0x08BD9AE8L, 0x00A6BFE2L, 0x07505CE4L, 0x1090F5F6L, 0x176616F0L,
+        0x1F7D33FAL, 0x188BD0FCL, 0x30FC61DEL, 0x370A82D8L, 0x3F11A7D2L, 0x38E744D4L,
+        0x2F27EDC6L, 0x28D10EC0L, 0x20CA2BCAL, 0x273CC8CCL, 0x7025498EL, 0x77D3AA88L,
+        0x7FC88F82L, 0x783E6C84L, 0x6FFEC596L, 0x68082690L, 0x6013039AL, 0x67E5E09CL,
+        0x4F9251BEL, 0x4864B2B8L, 0x407F97B2L, 0x478974B4L, 0x5049DDA6L, 0x57BF3EA0L,
+        0x5FA41BAAL, 0x5852F8ACL, 0xF197192EL, 0xF661FA28L, 0xFE7ADF22L, 0xF98C3C24L,
+        0xEE4C9536L, 0xE9BA7630L, 0xE1A1533AL, 0xE657B03CL, 0xCE20011EL, 0xC9D6E218L,
+        0xC1CDC712L, 0xC63B2414L, 0xD1FB8D06L, 0xD60D6E00L, 0xDE164B0AL, 0xD9E0A80CL,
+        0x8EF9294EL, 0x890FCA48L, 0x8114EF42L, 0x86E20C44L, 0x9122A556L, 0x96D44650L,
+        0x9ECF635AL, 0x9939805CL, 0xB14E317EL, 0xB6B8D278L, 0xBEA3F772L, 0xB9551474L,
+        0xAE95BD66L, 0xA9635E60L, 0xA1787B6AL, 0xA68E986CL
+        },
+        {
+        0x00000000L, 0xE8A45605L, 0xD589B1BDL, 0x3D2DE7B8L, 0xAFD27ECDL, 0x477628C8L,
+        0x7A5BCF70L, 0x92FF9975L, 0x5B65E02DL, 0xB3C1B628L, 0x8EEC5190L, 0x66480795L,
+        0xF4B79EE0L, 0x1C13C8E5L, 0x213E2F5DL, 0xC99A7958L, 0xB6CBC05AL, 0x5E6F965FL,
+        0x634271E7L, 0x8BE627E2L, 0x1919BE97L, 0xF1BDE892L, 0xCC900F2AL, 0x2434592FL,
+        0xEDAE2077L, 0x050A7672L, 0x382791CAL, 0xD083C7CFL, 0x427C5EBAL, 0xAAD808BFL,
+        0x97F5EF07L, 0x7F51B902L, 0x69569D03L, 0x81F2CB06L, 0xBCDF2CBEL, 0x547B7ABBL,
+        0xC684E3CEL, 0x2E20B5CBL, 0x130D5273L, 0xFBA90476L, 0x32337D2EL, 0xDA972B2BL,
+        0xE7BACC93L, 0x0F1E9A96L, 0x9DE103E3L, 0x754555E6L, 0x4868B25EL, 0xA0CCE45BL,
+        0xDF9D5D59L, 0x37390B5CL, 0x0A14ECE4L, 0xE2B0BAE1L, 0x704F2394L, 0x98EB7591L,
+        0xA5C69229L, 0x4D62C42CL, 0x84F8BD74L, 0x6C5CEB71L, 0x51710CC9L, 0xB9D55ACCL,
+        0x2B2AC3B9L, 0xC38E95BCL, 0xFEA37204L, 0x16072401L, 0xD2AD3A06L, 0x3A096C03L,
+        0x07248BBBL, 0xEF80DDBEL, 0x7D7F44CBL, 0x95DB12CEL, 0xA8F6F576L, 0x4052A373L,
+        0x89C8DA2BL, 0x616C8C2EL, 0x5C416B96L, 0xB4E53D93L, 0x261AA4E6L, 0xCEBEF2E3L,
+        0xF393155BL, 0x1B37435EL, 0x6466FA5CL, 0x8CC2AC59L, 0xB1EF4BE1L, 0x594B1DE4L,
+        0xCBB48491L, 0x2310D294L, 0x1E3D352CL, 0xF6996329L, 0x3F031A71L, 0xD7A74C74L,
+        0xEA8AABCCL, 0x022EFDC9L, 0x90D164BCL, 0x787532B9L, 0x4558D501L, 0xADFC8304L,
+        0xBBFBA705L, 0x535FF100L, 0x6E7216B8L, 0x86D640BDL, 0x1429D9C8L, 0xFC8D8FCDL,
+        0xC1A06875L, 0x29043E70L, 0xE09E4728L, 0x083A112DL, 0x3517F695L, 0xDDB3A090L,
+        0x4F4C39E5L, 0xA7E86FE0L, 0x9AC58858L, 0x7261DE5DL, 0x0D30675FL, 0xE594315AL,
+        0xD8B9D6E2L, 0x301D80E7L, 0xA2E21992L, 0x4A464F97L, 0x776BA82FL, 0x9FCFFE2AL,
+        0x56558772L, 0xBEF1D177L, 0x83DC36CFL, 0x6B7860CAL, 0xF987F9BFL, 0x1123AFBAL,
+        0x2C0E4802L, 0xC4AA1E07L, 0xA19B69BBL, 0x493F3FBEL, 0x7412D806L, 0x9CB68E03L,
+        0x0E491776L, 0xE6ED4173L, 0xDBC0A6CBL, 0x3364F0CEL, 0xFAFE8996L, 0x125ADF93L,
+        0x2F77382BL, 0xC7D36E2EL, 0x552CF75BL, 0xBD88A15EL, 0x80A546E6L, 0x680110E3L,
+        0x1750A9E1L, 0xFFF4FFE4L, 0xC2D9185CL, 0x2A7D4E59L, 0xB882D72CL, 0x50268129L,
+        0x6D0B6691L, 0x85AF3094L, 0x4C3549CCL, 0xA4911FC9L, 0x99BCF871L, 0x7118AE74L,
+        0xE3E73701L, 0x0B436104L, 0x366E86BCL, 0xDECAD0B9L, 0xC8CDF4B8L, 0x2069A2BDL,
+        0x1D444505L, 0xF5E01300L, 0x671F8A75L, 0x8FBBDC70L, 0xB2963BC8L, 0x5A326DCDL,
+        0x93A81495L, 0x7B0C4290L, 0x4621A528L, 0xAE85F32DL, 0x3C7A6A58L, 0xD4DE3C5DL,
+        0xE9F3DBE5L, 0x01578DE0L, 0x7E0634E2L, 0x96A262E7L, 0xAB8F855FL, 0x432BD35AL,
+        0xD1D44A2FL, 0x39701C2AL, 0x045DFB92L, 0xECF9AD97L, 0x2563D4CFL, 0xCDC782CAL,
+        0xF0EA6572L, 0x184E3377L, 0x8AB1AA02L, 0x6215FC07L, 0x5F381BBFL, 0xB79C4DBAL,
+        0x733653BDL, 0x9B9205B8L, 0xA6BFE200L, 0x4E1BB405L, 0xDCE42D70L, 0x34407B75L,
+        0x096D9CCDL, 0xE1C9CAC8L, 0x2853B390L, 0xC0F7E595L, 0xFDDA022DL, 0x157E5428L,
+        0x8781CD5DL, 0x6F259B58L, 0x52087CE0L, 0xBAAC2AE5L, 0xC5FD93E7L, 0x2D59C5E2L,
+        0x1074225AL, 0xF8D0745FL, 0x6A2FED2AL, 0x828BBB2FL, 0xBFA65C97L, 0x57020A92L,
+        0x9E9873CAL, 0x763C25CFL, 0x4B11C277L, 0xA3B59472L, 0x314A0D07L, 0xD9EE5B02L,
+        0xE4C3BCBAL, 0x0C67EABFL, 0x1A60CEBEL, 0xF2C498BBL, 0xCFE97F03L, 0x274D2906L,
+        0xB5B2B073L, 0x5D16E676L, 0x603B01CEL, 0x889F57CBL, 0x41052E93L, 0xA9A17896L,
+        0x948C9F2EL, 0x7C28C92BL, 0xEED7505EL, 0x0673065BL, 0x3B5EE1E3L, 0xD3FAB7E6L,
+        0xACAB0EE4L, 0x440F58E1L, 0x7922BF59L, 0x9186E95CL, 0x03797029L, 0xEBDD262CL,
+        0xD6F0C194L, 0x3E549791L, 0xF7CEEEC9L, 0x1F6AB8CCL, 0x22475F74L, 0xCAE30971L,
+        0x581C9004L, 0xB0B8C601L, 0x8D9521B9L, 0x653177BCL
+        },
+        {
+        0x00000000L, 0x47F7CEC1L, 0x8FEF9D82L, 0xC8185343L, 0x1B1E26B3L, 0x5CE9E872L,
+        0x94F1BB31L, 0xD30675F0L, 0x363C4D66L, 0x71CB83A7L, 0xB9D3D0E4L, 0xFE241E25L,
+        0x2D226BD5L, 0x6AD5A514L, 0xA2CDF657L, 0xE53A3896L, 0x6C789ACCL, 0x2B8F540DL,
+        0xE397074EL, 0xA460C98FL, 0x7766BC7FL, 0x309172BEL, 0xF88921FDL, 0xBF7EEF3CL,
+        0x5A44D7AAL, 0x1DB3196BL, 0xD5AB4A28L, 0x925C84E9L, 0x415AF119L, 0x06AD3FD8L,
+        0xCEB56C9BL, 0x8942A25AL, 0xD8F13598L, 0x9F06FB59L, 0x571EA81AL, 0x10E966DBL,
+        0xC3EF132BL, 0x8418DDEAL, 0x4C008EA9L, 0x0BF74068L, 0xEECD78FEL, 0xA93AB63FL,
+        0x6122E57CL, 0x26D52BBDL, 0xF5D35E4DL, 0xB224908CL, 0x7A3CC3CFL, 0x3DCB0D0EL,
+        0xB489AF54L, 0xF37E6195L, 0x3B6632D6L, 0x7C91FC17L, 0xAF9789E7L, 0xE8604726L,
+        0x20781465L, 0x678FDAA4L, 0x82B5E232L, 0xC5422CF3L, 0x0D5A7FB0L, 0x4AADB171L,
+        0x99ABC481L, 0xDE5C0A40L, 0x16445903L, 0x51B397C2L, 0xB5237687L, 0xF2D4B846L,
+        0x3ACCEB05L, 0x7D3B25C4L, 0xAE3D5034L, 0xE9CA9EF5L, 0x21D2CDB6L, 0x66250377L,
+        0x831F3BE1L, 0xC4E8F520L, 0x0CF0A663L, 0x4B0768A2L, 0x98011D52L, 0xDFF6D393L,
+        0x17EE80D0L, 0x50194E11L, 0xD95BEC4BL, 0x9EAC228AL, 0x56B471C9L, 0x1143BF08L,
+        0xC245CAF8L, 0x85B20439L, 0x4DAA577AL, 0x0A5D99BBL, 0xEF67A12DL, 0xA8906FECL,
+        0x60883CAFL, 0x277FF26EL, 0xF479879EL, 0xB38E495FL, 0x7B961A1CL, 0x3C61D4DDL,
+        0x6DD2431FL, 0x2A258DDEL, 0xE23DDE9DL, 0xA5CA105CL, 0x76CC65ACL, 0x313BAB6DL,
+        0xF923F82EL, 0xBED436EFL, 0x5BEE0E79L, 0x1C19C0B8L, 0xD40193FBL, 0x93F65D3AL,
+        0x40F028CAL, 0x0707E60BL, 0xCF1FB548L, 0x88E87B89L, 0x01AAD9D3L, 0x465D1712L,
+        0x8E454451L, 0xC9B28A90L, 0x1AB4FF60L, 0x5D4331A1L, 0x955B62E2L, 0xD2ACAC23L,
+        0x379694B5L, 0x70615A74L, 0xB8790937L, 0xFF8EC7F6L, 0x2C88B206L, 0x6B7F7CC7L,
+        0xA3672F84L, 0xE490E145L, 0x6E87F0B9L, 0x29703E78L, 0xE1686D3BL, 0xA69FA3FAL,
+        0x7599D60AL, 0x326E18CBL, 0xFA764B88L, 0xBD818549L, 0x58BBBDDFL, 0x1F4C731EL,
+        0xD754205DL, 0x90A3EE9CL, 0x43A59B6CL, 0x045255ADL, 0xCC4A06EEL, 0x8BBDC82FL,
+        0x02FF6A75L, 0x4508A4B4L, 0x8D10F7F7L, 0xCAE73936L, 0x19E14CC6L, 0x5E168207L,
+        0x960ED144L, 0xD1F91F85L, 0x34C32713L, 0x7334E9D2L, 0xBB2CBA91L, 0xFCDB7450L,
+        0x2FDD01A0L, 0x682ACF61L, 0xA0329C22L, 0xE7C552E3L, 0xB676C521L, 0xF1810BE0L,
+        0x399958A3L, 0x7E6E9662L, 0xAD68E392L, 0xEA9F2D53L, 0x22877E10L, 0x6570B0D1L,
+        0x804A8847L, 0xC7BD4686L, 0x0FA515C5L, 0x4852DB04L, 0x9B54AEF4L, 0xDCA36035L,
+        0x14BB3376L, 0x534CFDB7L, 0xDA0E5FEDL, 0x9DF9912CL, 0x55E1C26FL, 0x12160CAEL,
+        0xC110795EL, 0x86E7B79FL, 0x4EFFE4DCL, 0x09082A1DL, 0xEC32128BL, 0xABC5DC4AL,
+        0x63DD8F09L, 0x242A41C8L, 0xF72C3438L, 0xB0DBFAF9L, 0x78C3A9BAL, 0x3F34677BL,
+        0xDBA4863EL, 0x9C5348FFL, 0x544B1BBCL, 0x13BCD57DL, 0xC0BAA08DL, 0x874D6E4CL,
+        0x4F553D0FL, 0x08A2F3CEL, 0xED98CB58L, 0xAA6F0599L, 0x627756DAL, 0x2580981BL,
+        0xF686EDEBL, 0xB171232AL, 0x79697069L, 0x3E9EBEA8L, 0xB7DC1CF2L, 0xF02BD233L,
+        0x38338170L, 0x7FC44FB1L, 0xACC23A41L, 0xEB35F480L, 0x232DA7C3L, 0x64DA6902L,
+        0x81E05194L, 0xC6179F55L, 0x0E0FCC16L, 0x49F802D7L, 0x9AFE7727L, 0xDD09B9E6L,
+        0x1511EAA5L, 0x52E62464L, 0x0355B3A6L, 0x44A27D67L, 0x8CBA2E24L, 0xCB4DE0E5L,
+        0x184B9515L, 0x5FBC5BD4L, 0x97A40897L, 0xD053C656L, 0x3569FEC0L, 0x729E3001L,
+        0xBA866342L, 0xFD71AD83L, 0x2E77D873L, 0x698016B2L, 0xA19845F1L, 0xE66F8B30L,
+        0x6F2D296AL, 0x28DAE7ABL, 0xE0C2B4E8L, 0xA7357A29L, 0x74330FD9L, 0x33C4C118L,
+        0xFBDC925BL, 0xBC2B5C9AL, 0x5911640CL, 0x1EE6AACDL, 0xD6FEF98EL, 0x9109374FL,
+        0x420F42BFL, 0x05F88C7EL, 0xCDE0DF3DL, 0x8A1711FCL
+        },
+        {
+        0x00000000L, 0xDD0FE172L, 0xBEDEDF53L, 0x63D13E21L, 0x797CA311L, 0xA4734263L,
+        0xC7A27C42L, 0x1AAD9D30L, 0xF2F94622L, 0x2FF6A750L, 0x4C279971L, 0x91287803L,
+        0x8B85E533L, 0x568A0441L, 0x355B3A60L, 0xE854DB12L, 0xE13391F3L, 0x3C3C7081L,
+        0x5FED4EA0L, 0x82E2AFD2L, 0x984F32E2L, 0x4540D390L, 0x2691EDB1L, 0xFB9E0CC3L,
+        0x13CAD7D1L, 0xCEC536A3L, 0xAD140882L, 0x701BE9F0L, 0x6AB674C0L, 0xB7B995B2L,
+        0xD468AB93L, 0x09674AE1L, 0xC6A63E51L, 0x1BA9DF23L, 0x7878E102L, 0xA5770070L,
+        0xBFDA9D40L, 0x62D57C32L, 0x01044213L, 0xDC0BA361L, 0x345F7873L, 0xE9509901L,
+        0x8A81A720L, 0x578E4652L, 0x4D23DB62L, 0x902C3A10L, 0xF3FD0431L, 0x2EF2E543L,
+        0x2795AFA2L, 0xFA9A4ED0L, 0x994B70F1L, 0x44449183L, 0x5EE90CB3L, 0x83E6EDC1L,
+        0xE037D3E0L, 0x3D383292L, 0xD56CE980L, 0x086308F2L, 0x6BB236D3L, 0xB6BDD7A1L,
+        0xAC104A91L, 0x711FABE3L, 0x12CE95C2L, 0xCFC174B0L, 0x898D6115L, 0x54828067L,
+        0x3753BE46L, 0xEA5C5F34L, 0xF0F1C204L, 0x2DFE2376L, 0x4E2F1D57L, 0x9320FC25L,
+        0x7B742737L, 0xA67BC645L, 0xC5AAF864L, 0x18A51916L, 0x02088426L, 0xDF076554L,
+        0xBCD65B75L, 0x61D9BA07L, 0x68BEF0E6L, 0xB5B11194L, 0xD6602FB5L, 0x0B6FCEC7L,
+        0x11C253F7L, 0xCCCDB285L, 0xAF1C8CA4L, 0x72136DD6L, 0x9A47B6C4L, 0x474857B6L,
+        0x24996997L, 0xF99688E5L, 0xE33B15D5L, 0x3E34F4A7L, 0x5DE5CA86L, 0x80EA2BF4L,
+        0x4F2B5F44L, 0x9224BE36L, 0xF1F58017L, 0x2CFA6165L, 0x3657FC55L, 0xEB581D27L,
+        0x88892306L, 0x5586C274L, 0xBDD21966L, 0x60DDF814L, 0x030CC635L, 0xDE032747L,
+        0xC4AEBA77L, 0x19A15B05L, 0x7A706524L, 0xA77F8456L, 0xAE18CEB7L, 0x73172FC5L,
+        0x10C611E4L, 0xCDC9F096L, 0xD7646DA6L, 0x0A6B8CD4L, 0x69BAB2F5L, 0xB4B55387L,
+        0x5CE18895L, 0x81EE69E7L, 0xE23F57C6L, 0x3F30B6B4L, 0x259D2B84L, 0xF892CAF6L,
+        0x9B43F4D7L, 0x464C15A5L, 0x17DBDF9DL, 0xCAD43EEFL, 0xA90500CEL, 0x740AE1BCL,
+        0x6EA77C8CL, 0xB3A89DFEL, 0xD079A3DFL, 0x0D7642ADL, 0xE52299BFL, 0x382D78CDL,
+        0x5BFC46ECL, 0x86F3A79EL, 0x9C5E3AAEL, 0x4151DBDCL, 0x2280E5FDL, 0xFF8F048FL,
+        0xF6E84E6EL, 0x2BE7AF1CL, 0x4836913DL, 0x9539704FL, 0x8F94ED7FL, 0x529B0C0DL,
+        0x314A322CL, 0xEC45D35EL, 0x0411084CL, 0xD91EE93EL, 0xBACFD71FL, 0x67C0366DL,
+        0x7D6DAB5DL, 0xA0624A2FL, 0xC3B3740EL, 0x1EBC957CL, 0xD17DE1CCL, 0x0C7200BEL,
+        0x6FA33E9FL, 0xB2ACDFEDL, 0xA80142DDL, 0x750EA3AFL, 0x16DF9D8EL, 0xCBD07CFCL,
+        0x2384A7EEL, 0xFE8B469CL, 0x9D5A78BDL, 0x405599CFL, 0x5AF804FFL, 0x87F7E58DL,
+        0xE426DBACL, 0x39293ADEL, 0x304E703FL, 0xED41914DL, 0x8E90AF6CL, 0x539F4E1EL,
+        0x4932D32EL, 0x943D325CL, 0xF7EC0C7DL, 0x2AE3ED0FL, 0xC2B7361DL, 0x1FB8D76FL,
+        0x7C69E94EL, 0xA166083CL, 0xBBCB950CL, 0x66C4747EL, 0x05154A5FL, 0xD81AAB2DL,
+        0x9E56BE88L, 0x43595FFAL, 0x208861DBL, 0xFD8780A9L, 0xE72A1D99L, 0x3A25FCEBL,
+        0x59F4C2CAL, 0x84FB23B8L, 0x6CAFF8AAL, 0xB1A019D8L, 0xD27127F9L, 0x0F7EC68BL,
+        0x15D35BBBL, 0xC8DCBAC9L, 0xAB0D84E8L, 0x7602659AL, 0x7F652F7BL, 0xA26ACE09L,
+        0xC1BBF028L, 0x1CB4115AL, 0x06198C6AL, 0xDB166D18L, 0xB8C75339L, 0x65C8B24BL,
+        0x8D9C6959L, 0x5093882BL, 0x3342B60AL, 0xEE4D5778L, 0xF4E0CA48L, 0x29EF2B3AL,
+        0x4A3E151BL, 0x9731F469L, 0x58F080D9L, 0x85FF61ABL, 0xE62E5F8AL, 0x3B21BEF8L,
+        0x218C23C8L, 0xFC83C2BAL, 0x9F52FC9BL, 0x425D1DE9L, 0xAA09C6FBL, 0x77062789L,
+        0x14D719A8L, 0xC9D8F8DAL, 0xD37565EAL, 0x0E7A8498L, 0x6DABBAB9L, 0xB0A45BCBL,
+        0xB9C3112AL, 0x64CCF058L, 0x071DCE79L, 0xDA122F0BL, 0xC0BFB23BL, 0x1DB05349L,
+        0x7E616D68L, 0xA36E8C1AL, 0x4B3A5708L, 0x9635B67AL, 0xF5E4885BL, 0x28EB6929L,
+        0x3246F419L, 0xEF49156BL, 0x8C982B4AL, 0x5197CA38L
+        },
+        {
+        0x00000000L, 0x2FB7BF3AL, 0x5F6F7E74L, 0x70D8C14EL, 0xBEDEFCE8L, 0x916943D2L,
+        0xE1B1829CL, 0xCE063DA6L, 0x797CE467L, 0x56CB5B5DL, 0x26139A13L, 0x09A42529L,
+        0xC7A2188FL, 0xE815A7B5L, 0x98CD66FBL, 0xB77AD9C1L, 0xF2F9C8CEL, 0xDD4E77F4L,
+        0xAD96B6BAL, 0x82210980L, 0x4C273426L, 0x63908B1CL, 0x13484A52L, 0x3CFFF568L,
+        0x8B852CA9L, 0xA4329393L, 0xD4EA52DDL, 0xFB5DEDE7L, 0x355BD041L, 0x1AEC6F7BL,
+        0x6A34AE35L, 0x4583110FL, 0xE1328C2BL, 0xCE853311L, 0xBE5DF25FL, 0x91EA4D65L,
+        0x5FEC70C3L, 0x705BCFF9L, 0x00830EB7L, 0x2F34B18DL, 0x984E684CL, 0xB7F9D776L,
+        0xC7211638L, 0xE896A902L, 0x269094A4L, 0x09272B9EL, 0x79FFEAD0L, 0x564855EAL,
+        0x13CB44E5L, 0x3C7CFBDFL, 0x4CA43A91L, 0x631385ABL, 0xAD15B80DL, 0x82A20737L,
+        0xF27AC679L, 0xDDCD7943L, 0x6AB7A082L, 0x45001FB8L, 0x35D8DEF6L, 0x1A6F61CCL,
+        0xD4695C6AL, 0xFBDEE350L, 0x8B06221EL, 0xA4B19D24L, 0xC6A405E1L, 0xE913BADBL,
+        0x99CB7B95L, 0xB67CC4AFL, 0x787AF909L, 0x57CD4633L, 0x2715877DL, 0x08A23847L,
+        0xBFD8E186L, 0x906F5EBCL, 0xE0B79FF2L, 0xCF0020C8L, 0x01061D6EL, 0x2EB1A254L,
+        0x5E69631AL, 0x71DEDC20L, 0x345DCD2FL, 0x1BEA7215L, 0x6B32B35BL, 0x44850C61L,
+        0x8A8331C7L, 0xA5348EFDL, 0xD5EC4FB3L, 0xFA5BF089L, 0x4D212948L, 0x62969672L,
+        0x124E573CL, 0x3DF9E806L, 0xF3FFD5A0L, 0xDC486A9AL, 0xAC90ABD4L, 0x832714EEL,
+        0x279689CAL, 0x082136F0L, 0x78F9F7BEL, 0x574E4884L, 0x99487522L, 0xB6FFCA18L,
+        0xC6270B56L, 0xE990B46CL, 0x5EEA6DADL, 0x715DD297L, 0x018513D9L, 0x2E32ACE3L,
+        0xE0349145L, 0xCF832E7FL, 0xBF5BEF31L, 0x90EC500BL, 0xD56F4104L, 0xFAD8FE3EL,
+        0x8A003F70L, 0xA5B7804AL, 0x6BB1BDECL, 0x440602D6L, 0x34DEC398L, 0x1B697CA2L,
+        0xAC13A563L, 0x83A41A59L, 0xF37CDB17L, 0xDCCB642DL, 0x12CD598BL, 0x3D7AE6B1L,
+        0x4DA227FFL, 0x621598C5L, 0x89891675L, 0xA63EA94FL, 0xD6E66801L, 0xF951D73BL,
+        0x3757EA9DL, 0x18E055A7L, 0x683894E9L, 0x478F2BD3L, 0xF0F5F212L, 0xDF424D28L,
+        0xAF9A8C66L, 0x802D335CL, 0x4E2B0EFAL, 0x619CB1C0L, 0x1144708EL, 0x3EF3CFB4L,
+        0x7B70DEBBL, 0x54C76181L, 0x241FA0CFL, 0x0BA81FF5L, 0xC5AE2253L, 0xEA199D69L,
+        0x9AC15C27L, 0xB576E31DL, 0x020C3ADCL, 0x2DBB85E6L, 0x5D6344A8L, 0x72D4FB92L,
+        0xBCD2C634L, 0x9365790EL, 0xE3BDB840L, 0xCC0A077AL, 0x68BB9A5EL, 0x470C2564L,
+        0x37D4E42AL, 0x18635B10L, 0xD66566B6L, 0xF9D2D98CL, 0x890A18C2L, 0xA6BDA7F8L,
+        0x11C77E39L, 0x3E70C103L, 0x4EA8004DL, 0x611FBF77L, 0xAF1982D1L, 0x80AE3DEBL,
+        0xF076FCA5L, 0xDFC1439FL, 0x9A425290L, 0xB5F5EDAAL, 0xC52D2CE4L, 0xEA9A93DEL,
+        0x249CAE78L, 0x0B2B1142L, 0x7BF3D00CL, 0x54446F36L, 0xE33EB6F7L, 0xCC8909CDL,
+        0xBC51C883L, 0x93E677B9L, 0x5DE04A1FL, 0x7257F525L, 0x028F346BL, 0x2D388B51L,
+        0x4F2D1394L, 0x609AACAEL, 0x10426DE0L, 0x3FF5D2DAL, 0xF1F3EF7CL, 0xDE445046L,
+        0xAE9C9108L, 0x812B2E32L, 0x3651F7F3L, 0x19E648C9L, 0x693E8987L, 0x468936BDL,
+        0x888F0B1BL, 0xA738B421L, 0xD7E0756FL, 0xF857CA55L, 0xBDD4DB5AL, 0x92636460L,
+        0xE2BBA52EL, 0xCD0C1A14L, 0x030A27B2L, 0x2CBD9888L, 0x5C6559C6L, 0x73D2E6FCL,
+        0xC4A83F3DL, 0xEB1F8007L, 0x9BC74149L, 0xB470FE73L, 0x7A76C3D5L, 0x55C17CEFL,
+        0x2519BDA1L, 0x0AAE029BL, 0xAE1F9FBFL, 0x81A82085L, 0xF170E1CBL, 0xDEC75EF1L,
+        0x10C16357L, 0x3F76DC6DL, 0x4FAE1D23L, 0x6019A219L, 0xD7637BD8L, 0xF8D4C4E2L,
+        0x880C05ACL, 0xA7BBBA96L, 0x69BD8730L, 0x460A380AL, 0x36D2F944L, 0x1965467EL,
+        0x5CE65771L, 0x7351E84BL, 0x03892905L, 0x2C3E963FL, 0xE238AB99L, 0xCD8F14A3L,
+        0xBD57D5EDL, 0x92E06AD7L, 0x259AB316L, 0x0A2D0C2CL, 0x7AF5CD62L, 0x55427258L,
+        0x9B444FFEL, 0xB4F3F0C4L, 0xC42B318AL, 0xEB9C8EB0L
+        }
+#endif
+    };
@@ -1,5 +1,9 @@
 #include "strfmt.h"
 
+#if defined(__SSE2__) && !defined(STRFMT_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
 
 // -- Size-limits for various conversions -- //
 
@@ -22,6 +26,93 @@
 // The unrolled versions tend to be faster, but also more instructions.
 #define __unrolled_versions
 
+// Emit two digits per step, from a 200-byte table, for 32- and 64-bit values,
+// which is faster still, but needs the table (and a count-leading-zeros).
+#define __digit_pairs
+
+// The array formatters convert four values at a time, using SSE2, where it is
+// available (and the digit-pair helpers are enabled).
+#if defined(__SSE2__) && defined(__digit_pairs) && !defined(STRFMT_NO_SIMD)
+#define __simd_arrays
+#endif
+
+
+// -- Digit-pair helpers -- //
+
+#ifdef __digit_pairs
+
+static const char digit_pairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+static const uint64_t pow10_u64[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull,
+    1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull
+};
+
+/**
+ * Number of decimal digits, without branches, as 'log10(x)' is approximately
+ * 'log2(x) * 1233 / 4096', and then corrected by one comparison.
+ *
+ * Note: 'x | 1' has the same number of digits as 'x', and makes zero a digit.
+ */
+static inline int count_digits32(uint32_t x)
+{
+    int t = ((32 - __builtin_clz(x | 1)) * 1233) >> 12;
+    return t + 1 - ((x | 1) < (uint32_t)pow10_u64[t]);
+}
+
+static inline int count_digits64(uint64_t x)
+{
+    int t = ((64 - __builtin_clzll(x | 1)) * 1233) >> 12;
+    return t + 1 - ((x | 1) < pow10_u64[t]);
+}
+
+/**
+ * Writes the digits of 'n' backwards, two at a time, ending just before 'end'.
+ */
+static inline void write_digits32(char* end, uint32_t n)
+{
+    while (n >= 100) {
+        uint32_t q = n / 100;
+        end -= 2;
+        memcpy(end, &digit_pairs[2 * (n - q * 100)], 2);
+        n = q;
+    }
+    if (n >= 10) {
+        memcpy(end - 2, &digit_pairs[2 * n], 2);
+    } else {
+        *(end - 1) = '0' + n;
+    }
+}
+
+/**
+ * Writes exactly eight digits (with leading zeros), ending just before 'end'.
+ */
+static inline void write_digits8(char* end, uint32_t n)
+{
+    for (int i=4; i--;) {
+        uint32_t q = n / 100;
+        end -= 2;
+        memcpy(end, &digit_pairs[2 * (n - q * 100)], 2);
+        n = q;
+    }
+}
+
+#endif  /* __digit_pairs */
+
 
 // -- 16-bit printing -- //
 
@@ -130,7 +221,12 @@ int sprinti16(char* buf, int16_t n)
 
 static inline char* __printu32(char* buf, uint32_t n)
 {
-#ifndef __unrolled_versions
+#if defined(__digit_pairs)
+
+    buf += count_digits32(n);
+    write_digits32(buf, n);
+
+#elif !defined(__unrolled_versions)
 
     char m[10];
     char* p = m;
@@ -196,11 +292,12 @@ char* printu32(char* buf, uint32_t n)
 
 char* printi32(char* buf, int32_t n)
 {
+    uint32_t u = (uint32_t)n;
     if (n < 0) {
-        n = -n;
+        u = 0u - u;     // '-n' overflows for 'INT32_MIN'
         *buf++ = '-';
     }
-    return __printu32(buf, n);
+    return __printu32(buf, u);
 }
 
 /**
@@ -210,11 +307,12 @@ char* printi32(char* buf, int32_t n)
 int sprinti32(char* buf, int32_t n)
 {
     char* p = buf;
+    uint32_t u = (uint32_t)n;
     if (n < 0) {
-        n = -n;
+        u = 0u - u;
         *buf++ = '-';
     }
-    return __printu32(buf, (uint32_t)n) - p;
+    return __printu32(buf, u) - p;
 }
 
 int sprintu32(char* buf, uint32_t n)
@@ -242,7 +340,23 @@ char* hex32(char* buf, uint32_t x)
 
 char* printu64(char* buf, uint64_t x)
 {
-#if 1
+#if defined(__digit_pairs)
+
+    // Eight digits at a time, using 32-bit arithmetic, until what's left fits in
+    // 32 bits
+    char* const end = buf + count_digits64(x);
+    char* p = end;
+
+    while (x > UINT32_MAX) {
+        uint64_t q = x / 100000000;
+        write_digits8(p, (uint32_t)(x - q * 100000000));
+        p -= 8;
+        x = q;
+    }
+    write_digits32(p, (uint32_t)x);
+    size_t n = end - buf;
+
+#elif 1
     char m[MAX_UINT64_BYTES - 1];
     char* p = &m[MAX_UINT64_BYTES - 2];
 
@@ -282,11 +396,12 @@ char* printu64(char* buf, uint64_t x)
 
 static inline char* __printi64(char* buf, int64_t n)
 {
+    uint64_t u = (uint64_t)n;
     if (n < 0) {
-	n = -n;
+        u = 0u - u;     // '-n' overflows for 'INT64_MIN'
         *(buf++) = '-';
     }
-    return printu64(buf, n);
+    return printu64(buf, u);
 }
 
 char* printi64(char* buf, int64_t n)
@@ -311,6 +426,224 @@ int sprintu64(char* buf, uint64_t n)
 }
 
 
+// -- Array printing -- //
+
+#ifdef __simd_arrays
+
+/**
+ * Converts four values, each less than 10^8, into eight (zero-padded) digits
+ * each, as bytes 0-9, where 'd01' holds the first two values, and 'd23' the
+ * others, most-significant digit first.
+ *
+ * Each value is split into two groups of four digits, 'abcd' and 'efgh', and
+ * then each group is broadcast into four 16-bit lanes, which are divided by
+ * 1000, 100, 10, and 1, using multiply-high, to give 'a', 'ab', 'abc', and
+ * 'abcd', and so the digits, after subtracting ten times the previous lane.
+ */
+static inline void digits8x4_sse2(__m128i m, __m128i* d01, __m128i* d23)
+{
+    const __m128i div10000 = _mm_set1_epi32((int)0xd1b71759);
+    const __m128i divpowers = _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768);
+    const __m128i shpowers = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768);
+    const __m128i ten = _mm_set1_epi16(10);
+
+    // 'abcd = m / 10000', using 32x32->64 multiplies of the even, then the odd,
+    // lanes, and 'efgh = m - abcd*10000'
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(m, div10000), 45);
+    __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(m, 32), div10000), 45);
+    __m128i abcd = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+    __m128i efgh = _mm_sub_epi32(m, _mm_madd_epi16(abcd, _mm_set1_epi32(10000)));
+
+    // [abcd0, efgh0, abcd1, efgh1, ...] as 16-bit lanes, scaled by four
+    __m128i g = _mm_slli_epi16(_mm_or_si128(abcd, _mm_slli_epi32(efgh, 16)), 2);
+    __m128i lo = _mm_unpacklo_epi16(g, g);
+    __m128i hi = _mm_unpackhi_epi16(g, g);
+
+    __m128i v[4] = {
+        _mm_unpacklo_epi32(lo, lo), _mm_unpackhi_epi32(lo, lo),
+        _mm_unpacklo_epi32(hi, hi), _mm_unpackhi_epi32(hi, hi)
+    };
+    for (int i=0; i<4; i++) {
+        __m128i q = _mm_mulhi_epu16(_mm_mulhi_epu16(v[i], divpowers), shpowers);
+        v[i] = _mm_sub_epi16(q, _mm_slli_epi64(_mm_mullo_epi16(q, ten), 16));
+    }
+
+    *d01 = _mm_packus_epi16(v[0], v[1]);
+    *d23 = _mm_packus_epi16(v[2], v[3]);
+}
+
+/**
+ * Prints the four magnitudes 'm', each followed by 'sep', and preceded by a
+ * '-' if the corresponding bit of 'neg' is set. The 'wide' magnitudes may be
+ * 10^8, or more, which the (constant-folded) 16-bit versions skip.
+ *
+ * Note: the digits are written using 8-byte stores, so up to seven bytes past
+ * the end of the output are overwritten.
+ */
+static inline char* __print4(char* p, __m128i m, int neg, char sep, const int wide)
+{
+    const __m128i bias = _mm_set1_epi32(0x80000000);
+    const __m128i limit = _mm_set1_epi32(99999999 ^ 0x80000000);
+    uint32_t hi[4] = {0, 0, 0, 0};
+
+    // The (rare) values of 10^8, or more, have their top digits printed first
+    if (wide && _mm_movemask_epi8(_mm_cmpgt_epi32(_mm_xor_si128(m, bias), limit))) {
+        uint32_t x[4];
+        _mm_storeu_si128((__m128i*)x, m);
+        for (int i=0; i<4; i++) {
+            hi[i] = x[i] / 100000000;
+            x[i] -= hi[i] * 100000000;
+        }
+        m = _mm_loadu_si128((const __m128i*)x);
+    }
+
+    __m128i d01, d23;
+    digits8x4_sse2(m, &d01, &d23);
+
+    // Bit-masks of the leading (and other) zero digits, for each value
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t zeros = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(d01, zero)) |
+        (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(d23, zero)) << 16;
+
+    char digits[32];
+    _mm_storeu_si128((__m128i*)digits, _mm_add_epi8(d01, _mm_set1_epi8('0')));
+    _mm_storeu_si128((__m128i*)&digits[16], _mm_add_epi8(d23, _mm_set1_epi8('0')));
+
+    for (int i=0; i<4; i++) {
+        uint64_t w;
+        int lz = 0;
+        memcpy(&w, &digits[8 * i], 8);
+
+        // Branch-free sign
+        *p = '-';
+        p += (neg >> i) & 1;
+
+        if (!wide || hi[i] == 0) {
+            // Skip the leading zeros, but always keep the last digit
+            lz = __builtin_ctz((~zeros >> (8 * i) & 0xff) | 0x80);
+        } else if (hi[i] >= 10) {
+            memcpy(p, &digit_pairs[2 * hi[i]], 2);
+            p += 2;
+        } else {
+            *p++ = '0' + hi[i];
+        }
+
+        // Little-endian, so the first digit is the low byte
+        w >>= 8 * lz;
+        memcpy(p, &w, 8);
+        p += 8 - lz;
+        *p++ = sep;
+    }
+    return p;
+}
+
+#endif  /* __simd_arrays */
+
+/**
+ * Replaces the final separator with the '\0', and returns the length.
+ */
+static inline size_t __finish_array(char* buf, char* p)
+{
+    if (p != buf) {
+        p--;
+    }
+    *p = '\0';
+    return (size_t)(p - buf);
+}
+
+/**
+ * String-print the 'n' values, separated by 'sep', into the given buffer,
+ * returning the number of non-'\0' chars written.
+ *
+ * Note(s):
+ *  - four values at a time, when SSE2 is available, and otherwise the scalar
+ *    '__printu32(..)', which also handles the remaining values;
+ *  - the buffer must have room for 'FORMAT_I32_ARRAY_BYTES(n)', which includes
+ *    slack for the 8-byte stores;
+ */
+size_t format_i32_array(char* buf, const int32_t* v, size_t n, char sep)
+{
+    char* p = buf;
+
+#ifdef __simd_arrays
+    for (; n >= 4; n -= 4, v += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)v);
+        __m128i s = _mm_srai_epi32(x, 31);
+        int neg = _mm_movemask_ps(_mm_castsi128_ps(x));
+        p = __print4(p, _mm_sub_epi32(_mm_xor_si128(x, s), s), neg, sep, 1);
+    }
+#endif
+
+    for (; n; n--, v++) {
+        if (*v < 0) {
+            *p++ = '-';
+        }
+        p = __printu32(p, *v < 0 ? 0u - (uint32_t)*v : (uint32_t)*v);
+        *p++ = sep;
+    }
+    return __finish_array(buf, p);
+}
+
+size_t format_u32_array(char* buf, const uint32_t* v, size_t n, char sep)
+{
+    char* p = buf;
+
+#ifdef __simd_arrays
+    for (; n >= 4; n -= 4, v += 4) {
+        p = __print4(p, _mm_loadu_si128((const __m128i*)v), 0, sep, 1);
+    }
+#endif
+
+    for (; n; n--, v++) {
+        p = __printu32(p, *v);
+        *p++ = sep;
+    }
+    return __finish_array(buf, p);
+}
+
+size_t format_i16_array(char* buf, const int16_t* v, size_t n, char sep)
+{
+    char* p = buf;
+
+#ifdef __simd_arrays
+    for (; n >= 4; n -= 4, v += 4) {
+        __m128i x = _mm_loadl_epi64((const __m128i*)v);
+        x = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+        __m128i s = _mm_srai_epi32(x, 31);
+        int neg = _mm_movemask_ps(_mm_castsi128_ps(x));
+        p = __print4(p, _mm_sub_epi32(_mm_xor_si128(x, s), s), neg, sep, 0);
+    }
+#endif
+
+    for (; n; n--, v++) {
+        if (*v < 0) {
+            *p++ = '-';
+        }
+        p = __printu16(p, *v < 0 ? (uint16_t)-*v : (uint16_t)*v);
+        *p++ = sep;
+    }
+    return __finish_array(buf, p);
+}
+
+size_t format_u16_array(char* buf, const uint16_t* v, size_t n, char sep)
+{
+    char* p = buf;
+
+#ifdef __simd_arrays
+    for (; n >= 4; n -= 4, v += 4) {
+        __m128i x = _mm_loadl_epi64((const __m128i*)v);
+        p = __print4(p, _mm_unpacklo_epi16(x, _mm_setzero_si128()), 0, sep, 0);
+    }
+#endif
+
+    for (; n; n--, v++) {
+        p = __printu16(p, *v);
+        *p++ = sep;
+    }
+    return __finish_array(buf, p);
+}
+
+
 // -- Float printing -- //
 
 /**
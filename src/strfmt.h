@@ -10,6 +10,16 @@
 #include <string.h>
 
 
+// -- Buffer sizes -- //
+
+// Buffer sizes for the array formatters, including the '\0', and the slack for
+// their 8-byte stores.
+#define FORMAT_I16_ARRAY_BYTES(n) ((size_t)(n) * 7 + 8)
+#define FORMAT_U16_ARRAY_BYTES(n) ((size_t)(n) * 6 + 8)
+#define FORMAT_I32_ARRAY_BYTES(n) ((size_t)(n) * 12 + 8)
+#define FORMAT_U32_ARRAY_BYTES(n) ((size_t)(n) * 11 + 8)
+
+
 // -- External user functions -- //
 
 #ifdef __cplusplus
@@ -32,6 +42,11 @@ int sprintu32(char* buf, uint32_t n);
 
 char* hex32(char* buf, uint32_t x);
 
+size_t format_i16_array(char* buf, const int16_t* v, size_t n, char sep);
+size_t format_u16_array(char* buf, const uint16_t* v, size_t n, char sep);
+size_t format_i32_array(char* buf, const int32_t* v, size_t n, char sep);
+size_t format_u32_array(char* buf, const uint32_t* v, size_t n, char sep);
+
 char* printu64(char* buf, uint64_t n);
 char* printi64(char* buf, int64_t n);
 int sprinti64(char* buf, int64_t n);
@@ -41,6 +56,9 @@ int float_to_str(char* buf, float n);
 int fp32_to_str(char* buf, float x);
 int double_to_str(char* buf, double n);
 
+int float_to_shortest(char* buf, float x);
+int double_to_shortest(char* buf, double x);
+
 
 // -- Helper-functions -- //
 
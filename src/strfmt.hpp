@@ -0,0 +1,250 @@
+#ifndef __STRFMT_HPP__
+#define __STRFMT_HPP__
+
+/**
+ * Compile-time format strings (C++20), which dispatch straight to the "strfmt.h"
+ * converters, so that building a response line has no run-time parsing, and
+ * no bounds-checks, as the worst-case size is also known at compile-time:
+ *
+ *   char line[STRFMT_SIZE("*d {} {x}\n", len, crc)];
+ *   char* end = STRFMT(line, "*d {} {x}\n", len, crc);
+ *
+ * Placeholders:
+ *  - "{}" uses the argument's type, so 'printi32(..)' for 'int32_t', etc., and
+ *    'float_to_str(..)' and 'double_to_str(..)', and a 'char' is copied as-is;
+ *  - "{x}" uses 'hex32(..)', for unsigned integers of up to 32 bits;
+ *  - "{s}" uses 'float_to_shortest(..)' and 'double_to_shortest(..)';
+ *  - "{{" and "}}" are literal braces;
+ *
+ * Note(s):
+ *  - malformed format strings, a wrong number of arguments, or an unsupported
+ *    argument type, are compile-time errors;
+ *  - the output is '\0'-terminated, and the end-pointer returned, as for the
+ *    'print*(..)' functions;
+ *  - formatting into an array checks (at compile-time) that it's large enough,
+ *    and into a pointer trusts the caller to have used 'STRFMT_SIZE(..)';
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "strfmt.h"
+
+
+namespace strfmt {
+
+
+// -- Format strings -- //
+
+/**
+ * String literal, as a (structural) type, so that it can be a template
+ * argument.
+ */
+template <std::size_t N>
+struct fixed_string {
+    char str[N];
+
+    constexpr fixed_string(const char (&s)[N])
+    {
+        for (std::size_t i = 0; i < N; i++) {
+            str[i] = s[i];
+        }
+    }
+};
+
+// Not 'constexpr', so calling it during constant-evaluation is an error
+inline void format_error(const char*) {}
+
+/**
+ * The format string, with its braces unescaped, and split into the literal text
+ * before each placeholder (and after the last).
+ */
+template <std::size_t N>
+struct parsed_format {
+    char text[N] = {};
+    char spec[N] = {};
+    std::size_t ends[N + 1] = {};
+    std::size_t args = 0;
+
+    constexpr std::size_t begin(std::size_t i) const { return i ? ends[i - 1] : 0; }
+    constexpr std::size_t length(std::size_t i) const { return ends[i] - begin(i); }
+};
+
+template <std::size_t N>
+constexpr parsed_format<N> parse(const fixed_string<N>& fmt)
+{
+    parsed_format<N> p;
+    std::size_t len = 0;
+
+    for (std::size_t i = 0; i + 1 < N; i++) {
+        char c = fmt.str[i];
+        if (c == '{' && fmt.str[i + 1] == '{') {
+            p.text[len++] = '{';
+            i++;
+        } else if (c == '}' && fmt.str[i + 1] == '}') {
+            p.text[len++] = '}';
+            i++;
+        } else if (c == '{') {
+            char s = fmt.str[i + 1];
+            if (s == '}') {
+                s = 'd';
+                i += 1;
+            } else if ((s == 'x' || s == 's') && fmt.str[i + 2] == '}') {
+                i += 2;
+            } else {
+                format_error("unknown placeholder, expected \"{}\", \"{x}\", or \"{s}\"");
+            }
+            p.spec[p.args] = s;
+            p.ends[p.args++] = len;
+        } else if (c == '}') {
+            format_error("unmatched '}', expected \"}}\"");
+        } else {
+            p.text[len++] = c;
+        }
+    }
+
+    p.ends[p.args] = len;
+    return p;
+}
+
+template <fixed_string Fmt>
+inline constexpr auto format_of = parse(Fmt);
+
+
+// -- Converters -- //
+
+template <typename T>
+inline constexpr bool is_int = std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>;
+
+/**
+ * Worst-case bytes (without the '\0') for the argument type, and placeholder.
+ */
+template <typename T, char Spec>
+constexpr std::size_t max_bytes()
+{
+    if constexpr (Spec == 'x') {
+        static_assert(is_int<T> && std::is_unsigned_v<T> && sizeof(T) <= 4, "\"{x}\" needs an unsigned integer, of up to 32 bits");
+        return 8;
+    } else if constexpr (Spec == 's') {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "\"{s}\" needs a float, or a double");
+        return std::is_same_v<T, float> ? 15 : 24;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return 1;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return 18;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return 28;
+    } else {
+        static_assert(is_int<T> && sizeof(T) <= 8, "\"{}\" needs an integer, a float, a double, or a char");
+        constexpr std::size_t digits = sizeof(T) <= 2 ? 5 : sizeof(T) <= 4 ? 10 : 20;
+        return digits + (std::is_signed_v<T> && sizeof(T) < 8 ? 1 : 0);
+    }
+}
+
+template <char Spec, typename T>
+inline char* convert(char* p, T x)
+{
+    if constexpr (Spec == 'x') {
+        return hex32(p, (uint32_t)x);
+    } else if constexpr (Spec == 's') {
+        if constexpr (std::is_same_v<T, float>) {
+            return p + float_to_shortest(p, x);
+        } else {
+            return p + double_to_shortest(p, x);
+        }
+    } else if constexpr (std::is_same_v<T, char>) {
+        *p = x;
+        return p + 1;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return p + float_to_str(p, x);
+    } else if constexpr (std::is_same_v<T, double>) {
+        return p + double_to_str(p, x);
+    } else if constexpr (sizeof(T) <= 2) {
+        return std::is_signed_v<T> ? printi16(p, (int16_t)x) : printu16(p, (uint16_t)x);
+    } else if constexpr (sizeof(T) <= 4) {
+        return std::is_signed_v<T> ? printi32(p, (int32_t)x) : printu32(p, (uint32_t)x);
+    } else {
+        return std::is_signed_v<T> ? printi64(p, (int64_t)x) : printu64(p, (uint64_t)x);
+    }
+}
+
+
+// -- Formatting -- //
+
+/**
+ * Worst-case bytes, including the '\0', for the format string, and arguments.
+ */
+template <fixed_string Fmt, typename... Args>
+constexpr std::size_t max_size()
+{
+    static_assert(format_of<Fmt>.args == sizeof...(Args), "wrong number of arguments for the format string");
+
+    return []<std::size_t... I>(std::index_sequence<I...>) {
+        constexpr auto& f = format_of<Fmt>;
+        return f.ends[f.args] + (max_bytes<std::decay_t<Args>, f.spec[I]>() + ... + 0) + 1;
+    }(std::index_sequence_for<Args...>{});
+}
+
+// As 'max_size(..)', but from the arguments, whose values aren't used
+template <fixed_string Fmt, typename... Args>
+constexpr std::size_t size_of(const Args&...)
+{
+    return max_size<Fmt, Args...>();
+}
+
+template <fixed_string Fmt, std::size_t I>
+inline char* literal(char* p)
+{
+    constexpr auto& f = format_of<Fmt>;
+    std::memcpy(p, &f.text[f.begin(I)], f.length(I));
+    return p + f.length(I);
+}
+
+/**
+ * Formats into the buffer, which must hold 'max_size<Fmt, Args...>()' bytes.
+ */
+template <fixed_string Fmt, typename... Args>
+inline char* format_to(char* buf, const Args&... args)
+{
+    static_assert(max_size<Fmt, Args...>() != 0);
+
+    char* p = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        constexpr auto& f = format_of<Fmt>;
+        char* q = buf;
+        ((q = convert<f.spec[I]>(literal<Fmt, I>(q), args)), ...);
+        return q;
+    }(std::index_sequence_for<Args...>{});
+
+    p = literal<Fmt, sizeof...(Args)>(p);
+    *p = '\0';
+    return p;
+}
+
+/**
+ * As 'format_to(..)', but an array is checked (at compile-time) to be large
+ * enough.
+ */
+template <fixed_string Fmt, typename Buf, typename... Args>
+inline char* format(Buf&& buf, const Args&... args)
+{
+    using B = std::remove_reference_t<Buf>;
+    if constexpr (std::is_array_v<B>) {
+        static_assert(std::extent_v<B> >= max_size<Fmt, Args...>(), "buffer too small for the format string, see STRFMT_SIZE(..)");
+    }
+    return format_to<Fmt>(static_cast<char*>(buf), args...);
+}
+
+
+}  // namespace strfmt
+
+
+// -- Macro front-end -- //
+
+#define STRFMT(buf, fmt, ...) (::strfmt::format<fmt>(buf __VA_OPT__(,) __VA_ARGS__))
+#define STRFMT_SIZE(fmt, ...) (::strfmt::size_of<fmt>(__VA_ARGS__))
+
+
+#endif /* __STRFMT_HPP__ */
@@ -0,0 +1,512 @@
+#include "strfmt.h"
+
+/**
+ * Shortest round-trip conversions, for 'float' and 'double', after Ulf Adams'
+ * "Ryu: Fast Float-to-String Conversion" (PLDI 2018).
+ *
+ * The value 'm * 2^e' lies in the interval of reals that round to it, and
+ * Ryu computes the (scaled) decimal bounds of that interval, using one
+ * multiplication each, by a pre-computed power of five. Digits are then
+ * removed while the bounds still differ, which leaves the shortest decimal in
+ * the interval, and the closest such decimal to the exact value.
+ *
+ * Note(s):
+ *  - the constant tables are generated by 'ryutab.py', and are ~11 kB, nearly
+ *    all for 'double';
+ *  - the 'double' version uses 64x64->128 multiplications, which are emulated
+ *    using 32-bit multiplications, when '__int128' is unavailable;
+ */
+
+// Constant tables, generated by 'ryutab.py'
+#include "ryu_tab.h"
+
+
+// -- Size-limits for various conversions -- //
+
+#define MAX_FLOAT_DIGITS  9
+#define MAX_DOUBLE_DIGITS 17
+
+
+// -- Helper-functions -- //
+
+// 'floor(log2(5^e)) + 1', for 0 <= e <= 3528
+static inline int32_t pow5bits(const int32_t e)
+{
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// 'floor(log10(2^e))', for 0 <= e <= 1650
+static inline uint32_t log10pow2(const int32_t e)
+{
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+// 'floor(log10(5^e))', for 0 <= e <= 2620
+static inline uint32_t log10pow5(const int32_t e)
+{
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+static inline uint32_t pow5factor(uint64_t x)
+{
+    uint32_t count = 0;
+    while (x % 5 == 0) {
+        x /= 5;
+        count++;
+    }
+    return count;
+}
+
+static inline int multiple_of_pow5(const uint64_t x, const uint32_t p)
+{
+    return pow5factor(x) >= p;
+}
+
+static inline int multiple_of_pow2(const uint64_t x, const uint32_t p)
+{
+    return (x & (((uint64_t)1 << p) - 1)) == 0;
+}
+
+/**
+ * Returns '(m * factor) >> shift', for the 64-bit 'factor', where 'shift > 32'.
+ */
+static inline uint32_t mul_shift32(const uint32_t m, const uint64_t factor, const int32_t shift)
+{
+    const uint64_t bits0 = (uint64_t)m * (uint32_t)factor;
+    const uint64_t bits1 = (uint64_t)m * (uint32_t)(factor >> 32);
+    return (uint32_t)(((bits0 >> 32) + bits1) >> (shift - 32));
+}
+
+/**
+ * Returns '(m * mul) >> j', for the 128-bit 'mul' (as '{ low, high }'), where
+ * '64 < j < 128'.
+ */
+static inline uint64_t mul_shift64(const uint64_t m, const uint64_t mul[2], const int32_t j)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 b0 = (unsigned __int128)m * mul[0];
+    const unsigned __int128 b2 = (unsigned __int128)m * mul[1];
+    return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+#else
+    // Schoolbook 64x64->128 multiplications, from 32-bit halves
+    uint64_t hi0, lo1, hi1;
+    {
+        const uint64_t a = m >> 32, b = (uint32_t)m;
+        const uint64_t c = mul[0] >> 32, d = (uint32_t)mul[0];
+        const uint64_t bd = b * d, ad = a * d, bc = b * c;
+        const uint64_t mid = (bd >> 32) + (uint32_t)ad + (uint32_t)bc;
+        hi0 = a * c + (ad >> 32) + (bc >> 32) + (mid >> 32);
+    }
+    {
+        const uint64_t a = m >> 32, b = (uint32_t)m;
+        const uint64_t c = mul[1] >> 32, d = (uint32_t)mul[1];
+        const uint64_t bd = b * d, ad = a * d, bc = b * c;
+        const uint64_t mid = (bd >> 32) + (uint32_t)ad + (uint32_t)bc;
+        lo1 = (mid << 32) | (uint32_t)bd;
+        hi1 = a * c + (ad >> 32) + (bc >> 32) + (mid >> 32);
+    }
+    const uint64_t sum = hi0 + lo1;
+    hi1 += sum < hi0;
+
+    const int32_t dist = j - 64;
+    return (hi1 << (64 - dist)) | (sum >> dist);
+#endif
+}
+
+
+// -- Decimal output -- //
+
+/**
+ * Writes the decimal 'digits * 10^e10', using the same layout as printf's
+ * "%g" (with 'prec' significant digits), so fixed-point for exponents in the
+ * range [-4, prec), and scientific otherwise, but without the trailing zeros.
+ */
+static int decimal_to_str(char* buf, int sign, uint64_t digits, int32_t e10, int prec)
+{
+    char* p = buf;
+    if (sign) {
+        *p++ = '-';
+    }
+
+    // Number of digits, and the (scientific) decimal exponent
+    char tmp[MAX_DOUBLE_DIGITS + 4];
+    const int n = (int)(printu64(tmp, digits) - tmp);
+    const int32_t e = e10 + n - 1;
+
+    if (e >= prec || e < -4) {
+        // Scientific, "d.ddde+XX"
+        *p++ = tmp[0];
+        if (n > 1) {
+            *p++ = '.';
+            memcpy(p, &tmp[1], n - 1);
+            p += n - 1;
+        }
+        *p++ = 'e';
+        *p++ = e < 0 ? '-' : '+';
+
+        uint32_t x = e < 0 ? -e : e;
+        if (x >= 100) {
+            *p++ = '0' + x / 100;
+            x %= 100;
+        }
+        *p++ = '0' + x / 10;
+        *p++ = '0' + x % 10;
+    } else if (e < 0) {
+        // Leading zeros, "0.000ddd"
+        *p++ = '0';
+        *p++ = '.';
+        for (int i = -e - 1; i--;) {
+            *p++ = '0';
+        }
+        memcpy(p, tmp, n);
+        p += n;
+    } else if (e + 1 >= n) {
+        // Integral, "ddd000"
+        memcpy(p, tmp, n);
+        p += n;
+        for (int i = e + 1 - n; i--;) {
+            *p++ = '0';
+        }
+    } else {
+        // Fractional, "dd.ddd"
+        memcpy(p, tmp, e + 1);
+        p += e + 1;
+        *p++ = '.';
+        memcpy(p, &tmp[e + 1], n - e - 1);
+        p += n - e - 1;
+    }
+
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+/**
+ * Writes the non-finite values, or a (signed) zero, and returns the length.
+ */
+static inline int special_to_str(char* buf, int sign, int nonfinite, int mantissa)
+{
+    if (nonfinite) {
+        if (mantissa) {
+            return stpcpy(buf, "NaN") - buf;
+        }
+        return stpcpy(buf, sign ? "-Inf" : "+Inf") - buf;
+    }
+    return stpcpy(buf, sign ? "-0" : "0") - buf;
+}
+
+
+// -- Float printing -- //
+
+/**
+ * Shortest decimal 'output * 10^exponent' that rounds to the float with the
+ * (biased) exponent and mantissa bit-fields.
+ */
+static inline uint32_t f2d(uint32_t ieee_mant, uint32_t ieee_expo, int32_t* exponent)
+{
+    int32_t e2;
+    uint32_t m2;
+    if (ieee_expo == 0) {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = ieee_mant;
+    } else {
+        e2 = (int32_t)ieee_expo - 127 - 23 - 2;
+        m2 = (1u << 23) | ieee_mant;
+    }
+    const int even = (m2 & 1) == 0;
+    const int accept_bounds = even;
+
+    // Interval of values that round to 'x', scaled by four
+    const uint32_t mv = 4 * m2;
+    const uint32_t mp = 4 * m2 + 2;
+    const uint32_t mm_shift = ieee_mant != 0 || ieee_expo <= 1;
+    const uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+    // Convert to decimal, as 'vr * 10^e10', with bounds 'vm' and 'vp'
+    uint32_t vr, vp, vm;
+    int32_t e10;
+    int vm_trailing_zeros = 0;
+    int vr_trailing_zeros = 0;
+    uint8_t last_removed_digit = 0;
+
+    if (e2 >= 0) {
+        const uint32_t q = log10pow2(e2);
+        const int32_t k = FLOAT_POW5_INV_BITCOUNT + pow5bits(q) - 1;
+        const int32_t i = -e2 + (int32_t)q + k;
+        e10 = (int32_t)q;
+        vr = mul_shift32(mv, FLOAT_POW5_INV_SPLIT[q], i);
+        vp = mul_shift32(mp, FLOAT_POW5_INV_SPLIT[q], i);
+        vm = mul_shift32(mm, FLOAT_POW5_INV_SPLIT[q], i);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            // The loop below removes no digits, so compute the one that was
+            // removed, for the rounding
+            const int32_t l = FLOAT_POW5_INV_BITCOUNT + pow5bits(q - 1) - 1;
+            last_removed_digit = (uint8_t)(mul_shift32(mv, FLOAT_POW5_INV_SPLIT[q - 1], -e2 + (int32_t)q - 1 + l) % 10);
+        }
+        if (q <= 9) {
+            // Only one of 'mp', 'mv', and 'mm' can be a multiple of five
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = multiple_of_pow5(mv, q);
+            } else if (accept_bounds) {
+                vm_trailing_zeros = multiple_of_pow5(mm, q);
+            } else {
+                vp -= multiple_of_pow5(mp, q);
+            }
+        }
+    } else {
+        const uint32_t q = log10pow5(-e2);
+        const int32_t i = -e2 - (int32_t)q;
+        const int32_t k = pow5bits(i) - FLOAT_POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+        e10 = (int32_t)q + e2;
+        vr = mul_shift32(mv, FLOAT_POW5_SPLIT[i], j);
+        vp = mul_shift32(mp, FLOAT_POW5_SPLIT[i], j);
+        vm = mul_shift32(mm, FLOAT_POW5_SPLIT[i], j);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int32_t)q - 1 - (pow5bits(i + 1) - FLOAT_POW5_BITCOUNT);
+            last_removed_digit = (uint8_t)(mul_shift32(mv, FLOAT_POW5_SPLIT[i + 1], j) % 10);
+        }
+        if (q <= 1) {
+            // 'mv' has at least 'q' trailing zero bits, as it's a multiple of 4
+            vr_trailing_zeros = 1;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 31) {
+            vr_trailing_zeros = multiple_of_pow2(mv, q - 1);
+        }
+    }
+
+    // Remove digits, while the bounds still differ
+    int32_t removed = 0;
+    uint32_t output;
+
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        // General case, which is rare
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+            // Round even, if the exact value is .....50..0
+            last_removed_digit = 4;
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+    } else {
+        // Common case
+        while (vp / 10 > vm / 10) {
+            last_removed_digit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || last_removed_digit >= 5);
+    }
+
+    *exponent = e10 + removed;
+    return output;
+}
+
+/**
+ * Shortest string that reads back (using 'strtof(..)') as exactly 'x', for the
+ * full range of floats, including denormals.
+ *
+ * Note(s):
+ *  - same layout as "%.9g", so fixed-point unless the exponent is less than -4,
+ *    or greater than 8;
+ *  - writes "NaN", "+Inf", or "-Inf", for non-finite values;
+ *  - needs a buffer of at least 16 bytes;
+ */
+int float_to_shortest(char* buf, float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+
+    const int sign = bits >> 31;
+    const uint32_t ieee_expo = (bits >> 23) & 0xff;
+    const uint32_t ieee_mant = bits & 0x7fffff;
+
+    if (ieee_expo == 0xff || (ieee_expo == 0 && ieee_mant == 0)) {
+        return special_to_str(buf, sign, ieee_expo == 0xff, ieee_mant != 0);
+    }
+
+    int32_t e10;
+    uint32_t digits = f2d(ieee_mant, ieee_expo, &e10);
+    return decimal_to_str(buf, sign, digits, e10, MAX_FLOAT_DIGITS);
+}
+
+
+// -- Double printing -- //
+
+/**
+ * Shortest decimal 'output * 10^exponent' that rounds to the double with the
+ * (biased) exponent and mantissa bit-fields.
+ */
+static inline uint64_t d2d(uint64_t ieee_mant, uint32_t ieee_expo, int32_t* exponent)
+{
+    int32_t e2;
+    uint64_t m2;
+    if (ieee_expo == 0) {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieee_mant;
+    } else {
+        e2 = (int32_t)ieee_expo - 1023 - 52 - 2;
+        m2 = ((uint64_t)1 << 52) | ieee_mant;
+    }
+    const int even = (m2 & 1) == 0;
+    const int accept_bounds = even;
+
+    // Interval of values that round to 'x', scaled by four
+    const uint64_t mv = 4 * m2;
+    const uint32_t mm_shift = ieee_mant != 0 || ieee_expo <= 1;
+
+    // Convert to decimal, as 'vr * 10^e10', with bounds 'vm' and 'vp'
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    int vm_trailing_zeros = 0;
+    int vr_trailing_zeros = 0;
+
+    if (e2 >= 0) {
+        // One digit more than needed, so that the last removed digit is known
+        const uint32_t q = log10pow2(e2) - (e2 > 3);
+        const int32_t k = DOUBLE_POW5_INV_BITCOUNT + pow5bits(q) - 1;
+        const int32_t i = -e2 + (int32_t)q + k;
+        e10 = (int32_t)q;
+        vr = mul_shift64(4 * m2, DOUBLE_POW5_INV_SPLIT[q], i);
+        vp = mul_shift64(4 * m2 + 2, DOUBLE_POW5_INV_SPLIT[q], i);
+        vm = mul_shift64(4 * m2 - 1 - mm_shift, DOUBLE_POW5_INV_SPLIT[q], i);
+
+        if (q <= 21) {
+            // Only one of 'mp', 'mv', and 'mm' can be a multiple of five
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = multiple_of_pow5(mv, q);
+            } else if (accept_bounds) {
+                vm_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+            } else {
+                vp -= multiple_of_pow5(mv + 2, q);
+            }
+        }
+    } else {
+        const uint32_t q = log10pow5(-e2) - (-e2 > 1);
+        const int32_t i = -e2 - (int32_t)q;
+        const int32_t k = pow5bits(i) - DOUBLE_POW5_BITCOUNT;
+        const int32_t j = (int32_t)q - k;
+        e10 = (int32_t)q + e2;
+        vr = mul_shift64(4 * m2, DOUBLE_POW5_SPLIT[i], j);
+        vp = mul_shift64(4 * m2 + 2, DOUBLE_POW5_SPLIT[i], j);
+        vm = mul_shift64(4 * m2 - 1 - mm_shift, DOUBLE_POW5_SPLIT[i], j);
+
+        if (q <= 1) {
+            // 'mv' has at least 'q' trailing zero bits, as it's a multiple of 4
+            vr_trailing_zeros = 1;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 63) {
+            vr_trailing_zeros = multiple_of_pow2(mv, q);
+        }
+    }
+
+    // Remove digits, while the bounds still differ
+    int32_t removed = 0;
+    uint8_t last_removed_digit = 0;
+    uint64_t output;
+
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        // General case, which is rare
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+            // Round even, if the exact value is .....50..0
+            last_removed_digit = 4;
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+    } else {
+        // Common case, removing two digits at a time, while possible
+        int round_up = 0;
+        if (vp / 100 > vm / 100) {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+
+    *exponent = e10 + removed;
+    return output;
+}
+
+/**
+ * Shortest string that reads back (using 'strtod(..)') as exactly 'x', for the
+ * full range of doubles, including denormals.
+ *
+ * Note(s):
+ *  - same layout as "%.17g", so fixed-point unless the exponent is less than
+ *    -4, or greater than 16;
+ *  - writes "NaN", "+Inf", or "-Inf", for non-finite values;
+ *  - needs a buffer of at least 25 bytes;
+ */
+int double_to_shortest(char* buf, double x)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+
+    const int sign = (int)(bits >> 63);
+    const uint32_t ieee_expo = (uint32_t)(bits >> 52) & 0x7ff;
+    const uint64_t ieee_mant = bits & (((uint64_t)1 << 52) - 1);
+
+    if (ieee_expo == 0x7ff || (ieee_expo == 0 && ieee_mant == 0)) {
+        return special_to_str(buf, sign, ieee_expo == 0x7ff, ieee_mant != 0);
+    }
+
+    int32_t e10;
+    uint64_t digits = d2d(ieee_mant, ieee_expo, &e10);
+    return decimal_to_str(buf, sign, digits, e10, MAX_DOUBLE_DIGITS);
+}
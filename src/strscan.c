@@ -0,0 +1,584 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "strscan.h"
+#include <locale.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Parse eight digits at a time, from 64-bit loads, which assumes little-endian.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && !defined(STRSCAN_NO_SWAR)
+#define __swar_digits
+#endif
+
+#define ONES  0x0101010101010101ull
+#define HIGHS 0x8080808080808080ull
+
+
+// -- Constants -- //
+
+static const uint32_t pow10_u32[9] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+};
+
+// Powers of ten that are exact, as 'float' and 'double'
+static const float pow10_f32[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static const double pow10_f64[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+    1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+// -- Helper-functions -- //
+
+static inline const char* skip_space(const char* p)
+{
+    while (*p == ' ' || (*p >= '\t' && *p <= '\r')) {
+        p++;
+    }
+    return p;
+}
+
+static inline int is_digit(char c)
+{
+    return (unsigned)(c - '0') < 10;
+}
+
+// Value of the hex digit, or -1
+static inline int hex_value(char c)
+{
+    if ((unsigned)(c - '0') < 10) {
+        return c - '0';
+    }
+    c |= 0x20;
+    if ((unsigned)(c - 'a') < 6) {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+
+// -- SWAR helpers -- //
+
+#ifdef __swar_digits
+
+/**
+ * Whether the 8-byte load at 'p' stays within its page, so that it can't fault,
+ * even if the string ends before the eighth byte.
+ */
+static inline int can_load8(const char* p)
+{
+    return ((uintptr_t)p & (STRSCAN_PAGE - 1)) <= STRSCAN_PAGE - 8;
+}
+
+/**
+ * The top bit of each byte of 'w' that is in the range ['lo', 'hi'], since
+ * adding '0x80 - lo' sets the top bit of bytes that are 'lo' or more, and there
+ * are no carries between bytes, as their top bits are cleared first.
+ */
+static inline uint64_t in_range8(uint64_t w, uint8_t lo, uint8_t hi)
+{
+    uint64_t w7 = w & ~HIGHS;
+    uint64_t ge = w7 + ONES * (uint8_t)(0x80 - lo);
+    uint64_t gt = w7 + ONES * (uint8_t)(0x80 - hi - 1);
+    return ge & ~gt & ~w & HIGHS;
+}
+
+/**
+ * Number of leading (lowest-addressed) bytes that are set in the 'mask'.
+ */
+static inline int leading8(uint64_t mask)
+{
+    return mask == HIGHS ? 8 : __builtin_ctzll(~mask & HIGHS) >> 3;
+}
+
+/**
+ * Value of eight digits, as bytes 0-9, with the first in the low byte, using
+ * three multiplies, which combine pairs, then quads, and then both halves.
+ */
+static inline uint32_t swar_dec8(uint64_t d)
+{
+    d = d * 10 + (d >> 8);
+    d = ((d & 0x000000FF000000FFull) * (100 + (1000000ull << 32)) +
+         ((d >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32))) >> 32;
+    return (uint32_t)d;
+}
+
+/**
+ * Value of eight hex digits, as bytes 0-15, with the first in the low byte.
+ */
+static inline uint32_t swar_hex8(uint64_t d)
+{
+    d = ((d << 4) | (d >> 8)) & 0x00FF00FF00FF00FFull;
+    d = (d | (d >> 8)) & 0x0000FFFF0000FFFFull;
+    d = (d | (d >> 16)) & 0xFFFFFFFFull;
+    return __builtin_bswap32((uint32_t)d);
+}
+
+#endif  /* __swar_digits */
+
+
+// -- Integer parsing -- //
+
+/**
+ * Accumulates up to 'max' decimal digits into '*x', returning the end pointer,
+ * and the number of digits in '*n'.
+ */
+static inline const char* scan_digits(const char* p, uint64_t* x, int max, int* n)
+{
+    uint64_t v = *x;
+    int count = 0;
+
+#ifdef __swar_digits
+    while (count + 8 <= max && can_load8(p)) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+
+        int k = leading8(in_range8(w, '0', '9'));
+        if (k == 0) {
+            break;
+        }
+
+        // Shift out the bytes past the digits, which leaves leading zeros
+        v = v * pow10_u32[k] + swar_dec8((w - ONES * '0') << (8 * (8 - k)));
+        p += k;
+        count += k;
+        if (k < 8) {
+            *x = v;
+            *n = count;
+            return p;
+        }
+    }
+#endif
+
+    while (count < max && is_digit(*p)) {
+        v = v * 10 + (*p++ - '0');
+        count++;
+    }
+
+    *x = v;
+    *n = count;
+    return p;
+}
+
+/**
+ * Unsigned decimal magnitude, up to 'UINT64_MAX', without any sign.
+ */
+static const char* scan_mag(const char* p, uint64_t* x)
+{
+    const char* s = p;
+    uint64_t v = 0;
+    int n;
+
+    while (*p == '0') {
+        p++;
+    }
+
+    // 19 digits can't overflow, and a 20th might
+    p = scan_digits(p, &v, 19, &n);
+    if (p == s) {
+        return NULL;
+    }
+    if (n == 19 && is_digit(*p)) {
+        uint64_t d = *p++ - '0';
+        if (v > (UINT64_MAX - d) / 10 || is_digit(*p)) {
+            return NULL;
+        }
+        v = v * 10 + d;
+    }
+
+    *x = v;
+    return p;
+}
+
+static inline const char* scan_unsigned(const char* s, uint64_t* x)
+{
+    const char* p = skip_space(s);
+    if (*p == '+') {
+        p++;
+    }
+    return scan_mag(p, x);
+}
+
+static inline const char* scan_signed(const char* s, uint64_t* x, int* neg)
+{
+    const char* p = skip_space(s);
+    *neg = *p == '-';
+    if (*p == '-' || *p == '+') {
+        p++;
+    }
+    return scan_mag(p, x);
+}
+
+/**
+ * Hex value, of up to 'max' significant digits, with an optional "0x".
+ */
+static const char* scan_hex(const char* s, uint64_t* x, int max)
+{
+    const char* p = skip_space(s);
+    if (p[0] == '0' && (p[1] | 0x20) == 'x' && hex_value(p[2]) >= 0) {
+        p += 2;
+    }
+
+    const char* start = p;
+    uint64_t v = 0;
+    int n = 0;
+
+    while (*p == '0') {
+        p++;
+    }
+
+#ifdef __swar_digits
+    while (n + 8 <= 16 && can_load8(p)) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+
+        uint64_t alpha = in_range8(w | ONES * 0x20, 'a', 'f');
+        int k = leading8(in_range8(w, '0', '9') | alpha);
+        if (k == 0) {
+            break;
+        }
+
+        // Letters are their low nibble, plus 9
+        uint64_t d = (w & ONES * 0x0f) + (alpha >> 7) * 9;
+        v = (v << (4 * k)) | swar_hex8(d << (8 * (8 - k)));
+        p += k;
+        n += k;
+        if (k < 8) {
+            break;
+        }
+    }
+#endif
+
+    // One digit more than 'max' is enough to detect an overflow
+    for (int d; n <= max && (d = hex_value(*p)) >= 0; p++, n++) {
+        v = (v << 4) | (uint64_t)d;
+    }
+
+    if (p == start || n > max) {
+        return NULL;
+    }
+    *x = v;
+    return p;
+}
+
+
+// -- Float parsing -- //
+
+/**
+ * Parses 'digits [. digits] [e [sign] digits]', as 'm * 10^e', where 'm' holds
+ * the first 19 significant digits, and sets '*inexact' if there were more.
+ */
+static const char* scan_decimal(const char* p, uint64_t* pm, int32_t* pe, int* inexact)
+{
+    const char* s = p;
+    uint64_t m = 0;
+    int32_t e = 0;
+    int n, k;
+
+    // Integral part
+    while (*p == '0') {
+        p++;
+    }
+    p = scan_digits(p, &m, 19, &n);
+    for (; is_digit(*p); p++) {
+        *inexact |= *p != '0';
+        e++;
+    }
+    int seen = p != s;
+
+    // Fractional part, where leading zeros (of a zero integral part) only move
+    // the exponent
+    if (*p == '.') {
+        const char* f = ++p;
+        if (n == 0) {
+            while (*p == '0') {
+                p++;
+            }
+            e -= (int32_t)(p - f);
+        }
+        p = scan_digits(p, &m, 19 - n, &k);
+        e -= k;
+        for (; is_digit(*p); p++) {
+            *inexact |= *p != '0';
+        }
+        seen |= p != f;
+    }
+    if (!seen) {
+        return NULL;
+    }
+
+    // Exponent, if there are digits after the 'e'
+    if ((*p | 0x20) == 'e') {
+        const char* q = p + 1;
+        int neg = *q == '-';
+        if (*q == '-' || *q == '+') {
+            q++;
+        }
+        if (is_digit(*q)) {
+            int32_t x = 0;
+            for (; is_digit(*q); q++) {
+                if (x < 100000) {
+                    x = x * 10 + (*q - '0');
+                }
+            }
+            e += neg ? -x : x;
+            p = q;
+        }
+    }
+
+    *pm = m;
+    *pe = e;
+    return p;
+}
+
+/**
+ * Parses "NaN", or "Inf" (after any sign), in either case.
+ */
+static inline const char* scan_special(const char* p, double* x)
+{
+    if ((p[0] | 0x20) == 'n' && (p[1] | 0x20) == 'a' && (p[2] | 0x20) == 'n') {
+        *x = __builtin_nan("");
+        return p + 3;
+    }
+    if ((p[0] | 0x20) == 'i' && (p[1] | 0x20) == 'n' && (p[2] | 0x20) == 'f') {
+        *x = __builtin_inf();
+        return p + 3;
+    }
+    return NULL;
+}
+
+
+// -- Exported functions -- //
+
+const char* scanu16(const char* s, uint16_t* x)
+{
+    uint64_t v;
+    const char* p = scan_unsigned(s, &v);
+    if (p == NULL || v > UINT16_MAX) {
+        return NULL;
+    }
+    *x = (uint16_t)v;
+    return p;
+}
+
+const char* scani16(const char* s, int16_t* x)
+{
+    uint64_t v;
+    int neg;
+    const char* p = scan_signed(s, &v, &neg);
+    if (p == NULL || v > (uint64_t)INT16_MAX + neg) {
+        return NULL;
+    }
+    *x = (int16_t)(neg ? -(int32_t)v : (int32_t)v);
+    return p;
+}
+
+const char* scanu32(const char* s, uint32_t* x)
+{
+    uint64_t v;
+    const char* p = scan_unsigned(s, &v);
+    if (p == NULL || v > UINT32_MAX) {
+        return NULL;
+    }
+    *x = (uint32_t)v;
+    return p;
+}
+
+const char* scani32(const char* s, int32_t* x)
+{
+    uint64_t v;
+    int neg;
+    const char* p = scan_signed(s, &v, &neg);
+    if (p == NULL || v > (uint64_t)INT32_MAX + neg) {
+        return NULL;
+    }
+    *x = (int32_t)(neg ? -(int64_t)v : (int64_t)v);
+    return p;
+}
+
+const char* scanu64(const char* s, uint64_t* x)
+{
+    return scan_unsigned(s, x);
+}
+
+const char* scani64(const char* s, int64_t* x)
+{
+    uint64_t v;
+    int neg;
+    const char* p = scan_signed(s, &v, &neg);
+    if (p == NULL || v > (uint64_t)INT64_MAX + neg) {
+        return NULL;
+    }
+    *x = neg ? -(int64_t)(v - 1) - 1 : (int64_t)v;
+    return p;
+}
+
+const char* scanhex32(const char* s, uint32_t* x)
+{
+    uint64_t v;
+    const char* p = scan_hex(s, &v, 8);
+    if (p != NULL) {
+        *x = (uint32_t)v;
+    }
+    return p;
+}
+
+const char* scanhex64(const char* s, uint64_t* x)
+{
+    return scan_hex(s, x, 16);
+}
+
+#ifdef LC_ALL_MASK
+
+/**
+ * The "C" locale, created once, as 'strtod(..)' and 'strtof(..)' use the
+ * current locale's decimal-point (so "3.14" stops at the '.' after a
+ * 'setlocale(LC_NUMERIC, "de_DE.UTF-8")'), which the decimal scanner doesn't.
+ */
+static locale_t c_locale(void)
+{
+    static _Atomic(locale_t) cached = (locale_t)0;
+
+    locale_t loc = atomic_load_explicit(&cached, memory_order_acquire);
+    if (loc == (locale_t)0) {
+        locale_t prev = (locale_t)0;
+        loc = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+        if (loc != (locale_t)0 && !atomic_compare_exchange_strong(&cached, &prev, loc)) {
+            freelocale(loc);
+            loc = prev;
+        }
+    }
+    return loc;
+}
+
+#endif
+
+/**
+ * Slow-paths, for the numbers the fast-paths can't round exactly, which are
+ * successful only if libc parses the same text as 'scan_decimal(..)'.
+ */
+static int slow_double(const char* p, const char* end, double* x)
+{
+    char* q;
+#ifdef LC_ALL_MASK
+    locale_t loc = c_locale();
+    if (loc == (locale_t)0) {
+        return 0;
+    }
+    *x = strtod_l(p, &q, loc);
+#else
+    *x = strtod(p, &q);
+#endif
+    return q == end;
+}
+
+static int slow_float(const char* p, const char* end, float* x)
+{
+    char* q;
+#ifdef LC_ALL_MASK
+    locale_t loc = c_locale();
+    if (loc == (locale_t)0) {
+        return 0;
+    }
+    *x = strtof_l(p, &q, loc);
+#else
+    *x = strtof(p, &q);
+#endif
+    return q == end;
+}
+
+/**
+ * Correctly-rounded 'double', which is exact when the (up to 2^53) digits, and
+ * the power of ten, are both exact doubles, as there's then only the one
+ * rounding (after W. Clinger), and 'strtod_l(..)', in the "C" locale, otherwise.
+ */
+const char* scandouble(const char* s, double* x)
+{
+    const char* p = skip_space(s);
+    const int neg = *p == '-';
+    if (*p == '-' || *p == '+') {
+        p++;
+    }
+
+    double d;
+    const char* end = scan_special(p, &d);
+    if (end == NULL) {
+        uint64_t m;
+        int32_t e;
+        int inexact = 0;
+        end = scan_decimal(p, &m, &e, &inexact);
+        if (end == NULL) {
+            return NULL;
+        }
+
+        if (m == 0) {
+            d = 0.0;
+        } else if (!inexact && m <= (1ull << 53) && e >= -22 && e <= 22) {
+            d = e < 0 ? (double)m / pow10_f64[-e] : (double)m * pow10_f64[e];
+        } else if (!slow_double(p, end, &d)) {
+            return NULL;
+        }
+    }
+
+    *x = neg ? -d : d;
+    return end;
+}
+
+/**
+ * Correctly-rounded 'float', as for 'scandouble(..)', or by rounding the exact
+ * 'double' (unless it's exactly half-way between two floats, so that rounding
+ * twice might differ from rounding once), and 'strtof_l(..)' otherwise.
+ */
+const char* scanfloat(const char* s, float* x)
+{
+    const char* p = skip_space(s);
+    const int neg = *p == '-';
+    if (*p == '-' || *p == '+') {
+        p++;
+    }
+
+    float f;
+    double d;
+    const char* end = scan_special(p, &d);
+    if (end != NULL) {
+        f = (float)d;
+    } else {
+        uint64_t m;
+        int32_t e;
+        int inexact = 0;
+        end = scan_decimal(p, &m, &e, &inexact);
+        if (end == NULL) {
+            return NULL;
+        }
+
+        if (m == 0) {
+            f = 0.0f;
+        } else if (!inexact && m <= (1u << 24) && e >= -10 && e <= 10) {
+            f = e < 0 ? (float)m / pow10_f32[-e] : (float)m * pow10_f32[e];
+        } else if (!inexact && m <= (1ull << 53) && e >= -22 && e <= 22) {
+            d = e < 0 ? (double)m / pow10_f64[-e] : (double)m * pow10_f64[e];
+
+            // Normal floats drop the low 29 bits of the mantissa
+            uint64_t bits;
+            memcpy(&bits, &d, sizeof(bits));
+            uint32_t expo = (uint32_t)(bits >> 52) & 0x7ff;
+            if (expo > 1023 - 127 && expo < 1023 + 128 && (bits & 0x1fffffff) != 0x10000000) {
+                f = (float)d;
+            } else if (!slow_float(p, end, &f)) {
+                return NULL;
+            }
+        } else if (!slow_float(p, end, &f)) {
+            return NULL;
+        }
+    }
+
+    *x = neg ? -f : f;
+    return end;
+}
@@ -0,0 +1,68 @@
+#ifndef __STRSCAN_H__
+#define __STRSCAN_H__
+
+/**
+ * String-to-number conversions, as the companions of "strfmt.h", for parsing
+ * the text that it formats (for example, the "*d 70112 aa699def" responses),
+ * without the locale-handling of 'strtol(..)', etc.
+ *
+ * Note(s):
+ *  - each parser skips leading white-space, and returns the pointer just past
+ *    the number, or NULL (leaving '*x' unchanged) if there are no digits, or
+ *    the value is out of range;
+ *  - decimal integers may have a sign ('+' or '-', but only '+' for unsigned),
+ *    and hex integers may have a "0x" (or "0X") prefix, and either case;
+ *  - 'scanfloat(..)' and 'scandouble(..)' parse fixed-point numbers, with an
+ *    optional exponent, and "NaN", "Inf", "+Inf", and "-Inf", and are correctly
+ *    rounded (so 'float_to_shortest(..)' and 'double_to_shortest(..)' output
+ *    reads back exactly), using libc only for the (rare) hard cases, and
+ *    then in the "C" locale, whatever 'setlocale(..)' has been called with;
+ *  - eight digits at a time are parsed using 64-bit loads (on little-endian
+ *    targets), which can read up to seven bytes past the end of the number,
+ *    but never across a 'STRSCAN_PAGE' boundary;
+ */
+
+#include <stdint.h>
+
+
+// -- Build-time configuration -- //
+
+// Memory-protection granularity, so that loads past the end of a number never
+// fault.
+#ifndef STRSCAN_PAGE
+#define STRSCAN_PAGE 4096
+#endif
+
+
+// -- External user functions -- //
+
+#ifdef __cplusplus
+extern "C"
+    {
+#endif
+
+
+// -- Exported functions -- //
+
+const char* scanu16(const char* s, uint16_t* x);
+const char* scani16(const char* s, int16_t* x);
+
+const char* scanu32(const char* s, uint32_t* x);
+const char* scani32(const char* s, int32_t* x);
+
+const char* scanu64(const char* s, uint64_t* x);
+const char* scani64(const char* s, int64_t* x);
+
+const char* scanhex32(const char* s, uint32_t* x);
+const char* scanhex64(const char* s, uint64_t* x);
+
+const char* scanfloat(const char* s, float* x);
+const char* scandouble(const char* s, double* x);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+
+#endif /* __STRSCAN_H__ */